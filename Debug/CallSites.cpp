@@ -0,0 +1,210 @@
+/*
+ * File CallSites.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file CallSites.cpp
+ * Implements class CallSites.
+ */
+
+#include "CallSites.hpp"
+
+#if VCALL_SITES && !VDEBUG
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "Lib/System.hpp"
+
+namespace Debug {
+
+using namespace std;
+
+const unsigned CallSites::MAX_DEPTH;
+const char* CallSites::_stack[MAX_DEPTH];
+std::atomic<unsigned> CallSites::_depth(0);
+
+/** Capacity of the profile table, must be a power of two */
+#define PROFILE_CAPACITY 8192
+
+namespace {
+
+/** Samples of one CALL site */
+struct ProfileEntry {
+  /** 0 for an unused entry */
+  const char* name;
+  /** samples in which the site was the innermost CALL */
+  unsigned long long self;
+  /** samples in which the site was anywhere on the stack */
+  unsigned long long total;
+  /** number of the last sample counted in @b total, to count recursive calls once */
+  unsigned long long lastSample;
+};
+
+// everything the signal handler touches is preallocated, it must not
+// allocate memory
+ProfileEntry profile[PROFILE_CAPACITY];
+unsigned profileEntries = 0;
+/** samples of sites that did not fit into the table or were too deep */
+ProfileEntry otherSites = { "(other)", 0, 0, 0 };
+/** samples taken outside of any CALL */
+ProfileEntry noSite = { "(outside of CALL)", 0, 0, 0 };
+unsigned long long samples = 0;
+
+const char* profileFile = 0;
+/** only the process which started the sampling writes the profile, not its forks */
+pid_t profilePid = 0;
+unsigned profileIntervalUs = 0;
+
+ProfileEntry& profileEntry(const char* name)
+{
+  size_t idx = (reinterpret_cast<size_t>(name)>>3)*2654435761u;
+  for (;;) {
+    idx &= PROFILE_CAPACITY-1;
+    ProfileEntry& e = profile[idx];
+    if (e.name == name) {
+      return e;
+    }
+    if (!e.name) {
+      if (profileEntries >= PROFILE_CAPACITY/2) {
+        return otherSites;
+      }
+      profileEntries++;
+      e.name = name;
+      return e;
+    }
+    idx++;
+  }
+}
+
+void countSample(ProfileEntry& e, bool innermost)
+{
+  if (innermost) {
+    e.self++;
+  }
+  if (e.lastSample != samples) {
+    e.lastSample = samples;
+    e.total++;
+  }
+}
+
+}
+
+/**
+ * Print the active CALL sites, the innermost first.
+ */
+void CallSites::printStack(ostream& out)
+{
+  unsigned depth = _depth.load(std::memory_order_relaxed);
+  out << "Call stack (innermost first):" << endl;
+  if (depth > MAX_DEPTH) {
+    out << "  (" << (depth-MAX_DEPTH) << " calls deeper than " << MAX_DEPTH << ")" << endl;
+  }
+  for (unsigned i = min(depth, MAX_DEPTH); i > 0; i--) {
+    out << "  " << _stack[i-1] << endl;
+  }
+}
+
+/**
+ * Handler of SIGPROF. Attribute the sample to the innermost CALL site
+ * and, inclusively, to all the sites on the stack.
+ */
+void CallSites::handleSample(int sigNum)
+{
+  unsigned depth = _depth.load(std::memory_order_relaxed);
+  std::atomic_signal_fence(std::memory_order_acquire);
+
+  samples++;
+  if (!depth) {
+    countSample(noSite, true);
+    return;
+  }
+  if (depth > MAX_DEPTH) {
+    countSample(otherSites, true);
+  }
+  for (unsigned i = min(depth, MAX_DEPTH); i > 0; i--) {
+    countSample(profileEntry(_stack[i-1]), i==depth);
+  }
+}
+
+/**
+ * Start taking a sample of the CALL stack every @b intervalUs
+ * microseconds of CPU time. The flat profile is written into
+ * @b fileName when Vampire terminates.
+ */
+void CallSites::startSampling(const char* fileName, unsigned intervalUs)
+{
+  profileFile = strdup(fileName);
+  profilePid = getpid();
+  profileIntervalUs = intervalUs;
+  Lib::System::addTerminationHandler(writeProfile);
+
+  signal(SIGPROF, handleSample);
+  struct itimerval tv;
+  tv.it_interval.tv_sec = intervalUs/1000000;
+  tv.it_interval.tv_usec = intervalUs%1000000;
+  tv.it_value = tv.it_interval;
+  setitimer(ITIMER_PROF, &tv, 0);
+}
+
+/**
+ * Write the flat profile, sites sorted by the number of samples in which
+ * they were the innermost CALL. Called on termination, so it uses stdio
+ * rather than anything that could allocate.
+ */
+void CallSites::writeProfile()
+{
+  if (getpid() != profilePid) {
+    return;
+  }
+  struct itimerval tv;
+  memset(&tv, 0, sizeof(tv));
+  setitimer(ITIMER_PROF, &tv, 0);
+  signal(SIGPROF, SIG_IGN);
+
+  ProfileEntry* entries[PROFILE_CAPACITY+2];
+  unsigned cnt = 0;
+  for (unsigned i = 0; i < PROFILE_CAPACITY; i++) {
+    if (profile[i].name) {
+      entries[cnt++] = &profile[i];
+    }
+  }
+  entries[cnt++] = &otherSites;
+  entries[cnt++] = &noSite;
+  sort(entries, entries+cnt, [](const ProfileEntry* e1, const ProfileEntry* e2) {
+    return e1->self > e2->self || (e1->self == e2->self && e1->total > e2->total);
+  });
+
+  FILE* f = fopen(profileFile, "w");
+  if (!f) {
+    return;
+  }
+  fprintf(f, "# %llu samples, one per %u us of CPU time\n", samples, profileIntervalUs);
+  fprintf(f, "# self%%\ttotal%%\tself\ttotal\tsite\n");
+  double all = samples ? samples : 1;
+  for (unsigned i = 0; i < cnt; i++) {
+    ProfileEntry* e = entries[i];
+    if (!e->total) {
+      continue;
+    }
+    fprintf(f, "%.2f\t%.2f\t%llu\t%llu\t%s\n", 100*e->self/all, 100*e->total/all,
+        e->self, e->total, e->name);
+  }
+  fclose(f);
+}
+
+}
+
+#endif
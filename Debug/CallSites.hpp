@@ -0,0 +1,91 @@
+/*
+ * File CallSites.hpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file CallSites.hpp
+ * Defines class CallSites, a cheap replacement of Tracer in release builds.
+ */
+
+#ifndef __CallSites__
+#define __CallSites__
+
+/**
+ * If VCALL_SITES is 1, the CALL macro in release builds pushes the name
+ * of the function on a fixed size stack, so that we can say where Vampire
+ * is when it crashes or gets killed, and take a sampling profile of
+ * a run (see the option sample_profile). Otherwise (the default) CALL
+ * expands to nothing in release builds.
+ *
+ * Recording is not cheap enough to be always on: CALL is in most of the
+ * hot functions, and the two stores per call slow a release build down
+ * by 50 to 80 percent on the problems in regressions/performance. Hence
+ * the default stays 0 and builds meant for crash reports or profiling
+ * have to be configured with VCALL_SITES=1.
+ */
+#ifndef VCALL_SITES
+#define VCALL_SITES 0
+#endif
+
+#if VCALL_SITES && !VDEBUG
+
+#include <atomic>
+#include <iosfwd>
+
+namespace Debug {
+
+class CallSites {
+public:
+  /** Number of outermost calls whose names are kept */
+  static const unsigned MAX_DEPTH = 512;
+
+  /** Keeps @b fun on the stack for the lifetime of the object */
+  class Frame {
+  public:
+    explicit Frame(const char* fun)
+    {
+      // only the main flow writes _depth, so a relaxed load and store do,
+      // and unlike an increment of an atomic they need no locked instruction
+      unsigned depth = _depth.load(std::memory_order_relaxed);
+      if (depth < MAX_DEPTH) {
+        _stack[depth] = fun;
+      }
+      // the sampling signal handler must not see the new depth before the name
+      std::atomic_signal_fence(std::memory_order_release);
+      _depth.store(depth+1, std::memory_order_relaxed);
+    }
+    ~Frame()
+    {
+      _depth.store(_depth.load(std::memory_order_relaxed)-1, std::memory_order_relaxed);
+    }
+  };
+
+  static void printStack(std::ostream& out);
+
+  static void startSampling(const char* fileName, unsigned intervalUs);
+
+private:
+  static void handleSample(int sigNum);
+  static void writeProfile();
+
+  /** Names passed to CALL, the innermost one at _depth-1 unless too deep */
+  static const char* _stack[MAX_DEPTH];
+  /**
+   * Number of active calls, may exceed MAX_DEPTH. Atomic, as it is read
+   * by the SIGPROF handler of the sampling profiler.
+   */
+  static std::atomic<unsigned> _depth;
+};
+
+}
+
+#endif
+
+#endif // __CallSites__
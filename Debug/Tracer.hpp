@@ -23,6 +23,8 @@
 #ifndef __Tracer__
 #  define __Tracer__
 
+#include "CallSites.hpp"
+
 #if VDEBUG
 
 #include <iostream>
@@ -135,7 +137,13 @@ template<class... A> void Tracer::printDbg(A... msg)
 #else // ! VDEBUG
 #  define DBG(...) {}
 #  define DBGE(x) {}
-#  define CALL(Fun) 
+#  if VCALL_SITES
+#    define AUX_CALL_(SEED,Fun) Debug::CallSites::Frame _tmp_##SEED##_(Fun);
+#    define AUX_CALL(SEED,Fun) AUX_CALL_(SEED,Fun)
+#    define CALL(Fun) AUX_CALL(__LINE__,Fun)
+#  else
+#    define CALL(Fun) 
+#  endif
 #  define CALLC(Fun,check) 
 #  define CONTROL(description)
 #endif
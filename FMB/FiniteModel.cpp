@@ -26,8 +26,6 @@
 #include "Kernel/Formula.hpp"
 #include "Kernel/FormulaUnit.hpp"
 #include "Kernel/Signature.hpp"
-#include "Kernel/Substitution.hpp"
-#include "Kernel/SubstHelper.hpp"
 
 #include "Lib/Environment.hpp"
 #include "Lib/DHMap.hpp"
@@ -62,7 +60,7 @@ FiniteModel::FiniteModel(unsigned size) : _size(size), _isPartial(false)
   for(unsigned f=0; f<env.signature->functions();f++){
     unsigned arity=env.signature->functionArity(f);
     f_offsets[f]=offsets;
-    unsigned add = pow(size,arity+1);
+    unsigned add = pow(size,arity);
     ASS(UINT_MAX - add > offsets);
     offsets += add;
   }
@@ -72,7 +70,7 @@ FiniteModel::FiniteModel(unsigned size) : _size(size), _isPartial(false)
   for(unsigned p=1; p<env.signature->predicates();p++){
     unsigned arity=env.signature->predicateArity(p);
     p_offsets[p]=offsets;
-    unsigned add = pow(size,arity+1);
+    unsigned add = pow(size,arity);
     ASS(UINT_MAX - add > offsets);
     offsets += add;
   }
@@ -347,23 +345,35 @@ unsigned FiniteModel::evaluateGroundTerm(Term* term)
   CALL("FiniteModel::evaluate(Term*)");
   ASS(term->ground());
 
+  return evaluateTerm(TermList(term));
+}
+
+unsigned FiniteModel::evaluateTerm(TermList trm)
+{
+  CALL("FiniteModel::evaluateTerm");
+
+  if(trm.isVar()){
+    unsigned v = trm.var();
+    if(v>=_assignment.size() || !_assignment[v]){
+      USER_ERROR("Was not expecting free variables in "+trm.toString());
+    }
+    return _assignment[v];
+  }
+  Term* term = trm.term();
+
 #if DEBUG_MODEL
-  cout << "evaluating ground term " << term->toString() << endl;
+  cout << "evaluating term " << term->toString() << endl;
   cout << "domain constant status " << isDomainConstant(term) << endl;
 #endif  
   if(isDomainConstant(term)) return getDomainConstant(term);
 
-  unsigned arity = env.signature->functionArity(term->functor());
-  DArray<unsigned> args(arity);
-  for(unsigned i=0;i<arity;i++){
-    args[i] = evaluateGroundTerm(term->nthArgument(i)->term());
-    if(args[i]==0) USER_ERROR("Could not evaluate "+term->toString());
-  }
-
+  unsigned arity = term->arity();
   unsigned var = f_offsets[term->functor()];
   unsigned mult = 1;
-  for(unsigned i=0;i<args.size();i++){
-    var += mult*(args[i]-1);
+  for(unsigned i=0;i<arity;i++){
+    unsigned arg = evaluateTerm(*term->nthArgument(i));
+    if(arg==0) USER_ERROR("Could not evaluate "+term->toString());
+    var += mult*(arg-1);
     mult *=_size;
   }
 #if VDEBUG
@@ -379,34 +389,40 @@ bool FiniteModel::evaluateGroundLiteral(Literal* lit)
   CALL("FiniteModel::evaluate(Literal*)");
   ASS(lit->ground());
 
+  return evaluateLiteral(lit);
+}
+
+bool FiniteModel::evaluateLiteral(Literal* lit)
+{
+  CALL("FiniteModel::evaluateLiteral");
+
 #if DEBUG_MODEL
-  cout << "Evaluating ground literal " << lit->toString() << endl;
+  cout << "Evaluating literal " << lit->toString() << endl;
 #endif
 
-  // evaluate all arguments
-  unsigned arity = env.signature->predicateArity(lit->functor());
-  DArray<unsigned> args(arity);
-  for(unsigned i=0;i<arity;i++){
-    args[i] = evaluateGroundTerm(lit->nthArgument(i)->term());
-    if(args[i]==0) USER_ERROR("Could not evaluate "+lit->toString()+
-                    " on "+(lit->nthArgument(i)->term()->toString())+
-                    ", probably a partial model");
-  }
-
   if(lit->isEquality()){
-    bool res = args[0]==args[1];
+    unsigned left = evaluateTerm(*lit->nthArgument(0));
+    unsigned right = evaluateTerm(*lit->nthArgument(1));
+    if(left==0 || right==0) USER_ERROR("Could not evaluate "+lit->toString()+", probably a partial model");
+    bool res = left==right;
 #if DEBUG_MODEL
-    cout << "Evaluate equality, args " << args[0] << " and " << args[1] << endl;
+    cout << "Evaluate equality, args " << left << " and " << right << endl;
     cout << "res is " << (lit->polarity() ? res : !res) << endl;
 #endif
     if(lit->polarity()) return res;
     else return !res;
   }
 
+  // evaluate all arguments straight into the index of the interpretation table
+  unsigned arity = lit->arity();
   unsigned var = p_offsets[lit->functor()];
   unsigned mult = 1;
-  for(unsigned i=0;i<args.size();i++){
-    var += mult*(args[i]-1);
+  for(unsigned i=0;i<arity;i++){
+    unsigned arg = evaluateTerm(*lit->nthArgument(i));
+    if(arg==0) USER_ERROR("Could not evaluate "+lit->toString()+
+                    " on "+(lit->nthArgument(i)->toString())+
+                    ", probably a partial model");
+    var += mult*(arg-1);
     mult *=_size;
   }  
 
@@ -466,17 +482,10 @@ bool FiniteModel::evaluate(Formula* formula,unsigned depth)
   bool isAnd = false;
   bool isImp = false;
   bool isXor = false;
-  bool isForall = false;
   switch(formula->connective()){
     // If it's a literal evaluate that
     case LITERAL:
-    {
-      Literal* lit = formula->literal();
-      if(!lit->ground()){ 
-        USER_ERROR("Was not expecting free variables in "+formula->toString());
-      }
-      return evaluateGroundLiteral(lit);
-    }
+      return evaluateLiteral(formula->literal());
 
     // Expand the standard ones
     case FALSE:
@@ -523,44 +532,48 @@ bool FiniteModel::evaluate(Formula* formula,unsigned depth)
 
     // Expand quantifications
     case FORALL:
-     isForall = true;
     case EXISTS:
-    {
-     Formula::VarList* vs = formula->vars();
-     int var = vs->head();
-
-     //cout << "Quant " << isForall << " with " << var << endl;
+      return evaluateQuantified(formula,formula->vars(),depth);
+    default:
+      USER_ERROR("Cannot evaluate " + formula->toString() + ", not supported");
+  }
+  
 
-     Formula* next = 0;
-     if(vs->tail()) next = new QuantifiedFormula(formula->connective(),vs->tail(),0,formula->qarg());
-     else next = formula->qarg();
+  NOT_IMPLEMENTED;
+  return false;
+}
 
-     for(unsigned c=1;c<=_size;c++){
-       Substitution s;
-       s.bind(var,getDomainConstant(c));
-       Formula* next_sub = SubstHelper::apply(next,s);
-       next_sub = SimplifyFalseTrue::simplify(next_sub);
-       next_sub = Flattening::flatten(next_sub); 
-       
-       bool res = evaluate(next_sub,depth+1);
+/**
+ * Evaluate the quantified @c formula by binding each of @c vars to every domain
+ * element in turn in _assignment and evaluating the body under that assignment.
+ */
+bool FiniteModel::evaluateQuantified(Formula* formula,Formula::VarList* vars,unsigned depth)
+{
+  CALL("FiniteModel::evaluateQuantified");
 
-       //TODO try and limit memory issues!
-       //     ideally delete the bits introduced by the application of SubstHelper::apply
-       //if(next_sub!=next) next_sub->destroy();
+  if(!vars){
+    return evaluate(formula->qarg(),depth+1);
+  }
 
-       if(isForall && !res) return false;
-       if(!isForall && res) return true;
-     }
+  bool isForall = formula->connective()==FORALL;
+  unsigned var = vars->head();
+  if(var>=_assignment.size()){
+    _assignment.expand(var+1,0);
+  }
 
-     return isForall;
+  bool res = isForall;
+  for(unsigned c=1;c<=_size;c++){
+    _assignment[var] = c;
+    bool sub = evaluateQuantified(formula,vars->tail(),depth);
+    if(sub != isForall){
+      res = sub;
+      break;
     }
-    default:
-      USER_ERROR("Cannot evaluate " + formula->toString() + ", not supported");
   }
-  
+  // the variable is unbound again outside of its quantifier
+  _assignment[var] = 0;
 
-  NOT_IMPLEMENTED;
-  return false;
+  return res;
 }
 
     /**
@@ -26,6 +26,7 @@
 
 #include "Kernel/Unit.hpp"
 #include "Kernel/Term.hpp"
+#include "Kernel/Formula.hpp"
 
 
 namespace FMB {
@@ -67,6 +68,10 @@ private:
  Formula* partialEvaluate(Formula* formula);
  // currently private as requires formula to be rectified
  bool evaluate(Formula* formula,unsigned depth=0);
+ bool evaluateQuantified(Formula* formula,Formula::VarList* vars,unsigned depth);
+ // variables are evaluated by _assignment
+ unsigned evaluateTerm(TermList term);
+ bool evaluateLiteral(Literal* literal);
 
  // The model is partial if there is a operation with arity n that does not have
  // coverage size^n in its related coverage map
@@ -79,6 +84,10 @@ private:
  DArray<unsigned> f_interpretation;
  DArray<unsigned> p_interpretation; // 0 is undef, 1 false, 2 true
 
+ // the domain element bound to each quantified variable (0 if unbound),
+ // quantifiers are expanded by updating this instead of instantiating the formula
+ DArray<unsigned> _assignment;
+
  DHMap<unsigned,Term*> _domainConstants;
  DHMap<Term*,unsigned> _domainConstantsRev;
 public:
@@ -150,6 +150,11 @@ FiniteModelBuilder::~FiniteModelBuilder()
 
     delete _dsaEnumerator;
   }
+
+  DHMap<Clause*,DArray<LiteralTemplate>*>::Iterator tit(_clauseTemplates);
+  while(tit.hasNext()){
+    delete tit.next();
+  }
 }
 
 // Do all setting up required for finite model search 
@@ -158,6 +163,109 @@ FiniteModelBuilder::~FiniteModelBuilder()
 bool FiniteModelBuilder::reset(){
   CALL("FiniteModelBuilder::reset");
 
+  // The contour encoding only ever grows the domains and all its clauses stay valid
+  // for larger sizes (they are guarded by the markers). So as long as the new sizes
+  // fit into the variable layout, we keep the solver and just add the new clauses
+  if(_xmass && _solver){
+    bool fits = true;
+    for(unsigned i=0;i<_distinctSortSizes.size();i++){
+      if(_distinctSortSizes[i] > _distinctSortLayoutSizes[i]){
+        fits = false;
+        break;
+      }
+    }
+    if(fits){
+      createSymmetryOrdering();
+      return true;
+    }
+  }
+
+  _distinctSortLayoutSizes.ensure(_distinctSortSizes.size());
+  _sortLayoutSizes.ensure(_sortModelSizes.size());
+  unsigned offsets;
+  bool layoutDone = false;
+  if(_xmass){
+    // leave some room for the domains to grow
+    for(unsigned i=0;i<_distinctSortSizes.size();i++){
+      unsigned size = _distinctSortSizes[i];
+      _distinctSortLayoutSizes[i] = max(size,min(size+size/2+1,_distinctSortMaxs[i]));
+    }
+    layoutDone = computeVariableLayout(offsets);
+  }
+  if(!layoutDone){
+    for(unsigned i=0;i<_distinctSortSizes.size();i++){
+      _distinctSortLayoutSizes[i] = _distinctSortSizes[i];
+    }
+    if(!computeVariableLayout(offsets)){
+      return false;
+    }
+  }
+
+  // nothing is encoded in the new solver yet
+  _sortEncodedSizes.init(_sortModelSizes.size(),0);
+  _distinctSortEncodedSizes.init(_distinctSortSizes.size(),0);
+
+  // Create a new SAT solver
+  try{
+    MinisatInterfacingNewSimp* solver = new MinisatInterfacingNewSimp(_opt,true);
+    if(_xmass){
+      // clauses over any of the variables can still come after solving, when the domains grow
+      solver->disableVariableElimination();
+    }
+    _solver = solver;
+  }catch(Minisat::OutOfMemoryException&){
+    MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
+  }
+
+  /*
+  if(_opt.satSolver() != Options::SatSolver::MINISAT){
+    cout << "Warning: overriding sat solver for FMB, using minisat" << endl;
+  }
+  */
+/*
+  switch(_opt.satSolver()){
+    case Options::SatSolver::VAMPIRE:
+      _solver = new TWLSolver(_opt, true);
+      break;
+#if VZ3
+    case Options::SatSolver::Z3:
+        ASSERTION_VIOLATION_REP("Do not use fmb with Z3");
+#endif
+    case Options::SatSolver::MINISAT:
+        try{
+          _solver = new MinisatInterfacingNewSimp(_opt,true);
+        }catch(Minisat::OutOfMemoryException&){
+          MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
+        }
+      break;
+    default:
+      ASSERTION_VIOLATION_REP(_opt.satSolver());
+  }
+*/
+
+  // set the number of SAT variables, this could cause an exception
+  _solver->ensureVarCount(offsets-1);
+
+  // needs to be redone for each size as we use this to pick the number of
+  // things to order and the constants to ground with 
+  createSymmetryOrdering();
+
+  return true;
+}
+
+/**
+ * Compute the SAT variable offsets of the symbols and the markers for the
+ * current _distinctSortLayoutSizes and set @b offsets to one more than the
+ * largest variable. Returns false if the variables would overflow.
+ */
+bool FiniteModelBuilder::computeVariableLayout(unsigned& offsets)
+{
+  CALL("FiniteModelBuilder::computeVariableLayout");
+
+  for(unsigned s=0;s<_sortedSignature->sorts;s++) {
+    _sortLayoutSizes[s] = _distinctSortLayoutSizes[_sortedSignature->parents[s]];
+  }
+
   // Construct the offsets for symbols
   // Each symbol requires size^n) variables where n is the number of spaces for grounding
   // For function symbols we have n=arity+1 as we have the return value
@@ -165,12 +273,12 @@ bool FiniteModelBuilder::reset(){
 
 
   // This has been refined after adding multiple sorts i.e. no general 'size'
-  // We now need the current size of the sort of each position to compute the offsets
+  // We now need the (layout) size of the sort of each position to compute the offsets
 
   static const unsigned VAR_MAX = MinisatInterfacingNewSimp::VAR_MAX;
 
   // Start from 1 as SAT solver variables are 1-based
-  unsigned offsets=1;
+  offsets=1;
   for(unsigned f=0; f<env.signature->functions();f++){
     if(del_f[f]) continue; 
     f_offsets[f]=offsets;
@@ -181,9 +289,9 @@ bool FiniteModelBuilder::reset(){
     DArray<unsigned> f_signature = _sortedSignature->functionSignatures[f];
     ASS(f_signature.size() == env.signature->functionArity(f)+1);
 
-    unsigned add = _sortModelSizes[f_signature[0]]; 
+    unsigned add = _sortLayoutSizes[f_signature[0]]; 
     for(unsigned i=1;i<f_signature.size();i++){
-      add *= _sortModelSizes[f_signature[i]];
+      add *= _sortLayoutSizes[f_signature[i]];
     }
 
     // Check that we do not overflow
@@ -205,7 +313,7 @@ bool FiniteModelBuilder::reset(){
     ASS(p_signature.size()==env.signature->predicateArity(p));
     unsigned add=1;
     for(unsigned i=0;i<p_signature.size();i++){
-      add *= _sortModelSizes[p_signature[i]];
+      add *= _sortLayoutSizes[p_signature[i]];
     }
 
     // Check for overflow
@@ -222,7 +330,7 @@ bool FiniteModelBuilder::reset(){
   if (_xmass) {
     marker_offsets.ensure(_distinctSortSizes.size());
     for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
-      unsigned add = _distinctSortSizes[i];
+      unsigned add = _distinctSortLayoutSizes[i];
 
       marker_offsets[i] = offsets;
 
@@ -255,46 +363,6 @@ bool FiniteModelBuilder::reset(){
     offsets += add;
   }
 
-  // Create a new SAT solver
-  try{
-    _solver = new MinisatInterfacingNewSimp(_opt,true);
-  }catch(Minisat::OutOfMemoryException&){
-    MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
-  }
-
-  /*
-  if(_opt.satSolver() != Options::SatSolver::MINISAT){
-    cout << "Warning: overriding sat solver for FMB, using minisat" << endl;
-  }
-  */
-/*
-  switch(_opt.satSolver()){
-    case Options::SatSolver::VAMPIRE:
-      _solver = new TWLSolver(_opt, true);
-      break;
-#if VZ3
-    case Options::SatSolver::Z3:
-        ASSERTION_VIOLATION_REP("Do not use fmb with Z3");
-#endif
-    case Options::SatSolver::MINISAT:
-        try{
-          _solver = new MinisatInterfacingNewSimp(_opt,true);
-        }catch(Minisat::OutOfMemoryException&){
-          MinisatInterfacingNewSimp::reportMinisatOutOfMemory();
-        }
-      break;
-    default:
-      ASSERTION_VIOLATION_REP(_opt.satSolver());
-  }
-*/
-
-  // set the number of SAT variables, this could cause an exception
-  _solver->ensureVarCount(offsets-1);
-
-  // needs to be redone for each size as we use this to pick the number of
-  // things to order and the constants to ground with 
-  createSymmetryOrdering();
-
   return true;
 }
 
@@ -910,11 +978,105 @@ void FiniteModelBuilder::init()
       }
 #endif
       _clauseVariableSorts.insert(c,csig);
+      createClauseTemplate(c);
       //cout << "done" << endl;
     } 
   }
 } // init()
 
+/**
+ * Record the grounding template of a flattened non-ground clause @b c,
+ * so that addNewInstances does not need to traverse its literals and
+ * terms again for every instance and every domain size.
+ */
+void FiniteModelBuilder::createClauseTemplate(Clause* c)
+{
+  CALL("FiniteModelBuilder::createClauseTemplate");
+
+  DArray<LiteralTemplate>* tmpl = new DArray<LiteralTemplate>(c->length());
+  for(unsigned i=0;i<c->length();i++){
+    Literal* lit = (*c)[i];
+    LiteralTemplate& lt = (*tmpl)[i];
+    lt.polarity = lit->polarity();
+    lt.twoVarEq = lit->isTwoVarEquality();
+    lt.base = 0;
+
+    if(lt.twoVarEq){
+      lt.symbol = 0;
+      lt.isFunction = false;
+      lt.vars.ensure(2);
+      lt.vars[0] = lit->nthArgument(0)->var();
+      lt.vars[1] = lit->nthArgument(1)->var();
+    }
+    else if(lit->isEquality()){
+      ASS(lit->nthArgument(0)->isTerm());
+      ASS(lit->nthArgument(1)->isVar());
+      Term* t = lit->nthArgument(0)->term();
+      unsigned arity = t->arity();
+      lt.symbol = t->functor();
+      lt.isFunction = true;
+      lt.vars.ensure(arity+1);
+      for(unsigned j=0;j<arity;j++){
+        ASS(t->nthArgument(j)->isVar());
+        lt.vars[j] = t->nthArgument(j)->var();
+      }
+      lt.vars[arity] = lit->nthArgument(1)->var();
+    }
+    else{
+      unsigned arity = lit->arity();
+      lt.symbol = lit->functor();
+      lt.isFunction = false;
+      lt.vars.ensure(arity);
+      for(unsigned j=0;j<arity;j++){
+        ASS(lit->nthArgument(j)->isVar());
+        lt.vars[j] = lit->nthArgument(j)->var();
+      }
+    }
+    lt.mults.ensure(lt.vars.size());
+  }
+  _clauseTemplates.insert(c,tmpl);
+}
+
+/**
+ * Compute the SAT variable offsets and position multipliers of the template
+ * @b tmpl for the current _sortLayoutSizes (i.e. what getSATLiteral computes
+ * for a single grounding).
+ */
+void FiniteModelBuilder::prepareClauseTemplate(DArray<LiteralTemplate>& tmpl)
+{
+  CALL("FiniteModelBuilder::prepareClauseTemplate");
+
+  for(unsigned i=0;i<tmpl.size();i++){
+    LiteralTemplate& lt = tmpl[i];
+    if(lt.twoVarEq){
+      continue;
+    }
+    const DArray<unsigned>& signature = lt.isFunction ?
+               _sortedSignature->functionSignatures[lt.symbol] :
+               _sortedSignature->predicateSignatures[lt.symbol];
+    lt.base = lt.isFunction ? f_offsets[lt.symbol] : p_offsets[lt.symbol];
+    unsigned mult=1;
+    for(unsigned j=0;j<lt.vars.size();j++){
+      lt.mults[j] = mult;
+      mult *= _sortLayoutSizes[signature[j]];
+    }
+  }
+}
+
+/**
+ * Return true if the first @b len values of @b grounding are all within the
+ * bounds @b encodedMax, i.e. the corresponding clause is already in the solver.
+ */
+static bool isEncodedGrounding(const DArray<unsigned>& grounding, const DArray<unsigned>& encodedMax, unsigned len)
+{
+  for(unsigned i=0;i<len;i++){
+    if(grounding[i] > encodedMax[i]){
+      return false;
+    }
+  }
+  return true;
+}
+
 void FiniteModelBuilder::addGroundClauses()
 {
   CALL("FiniteModelBuilder::addGroundClauses");
@@ -922,6 +1084,9 @@ void FiniteModelBuilder::addGroundClauses()
   // If we don't have any ground clauses don't do anything
   if(!_groundClauses) return;
 
+  // They don't depend on the sizes, so a kept solver already has them
+  if(_sortEncodedSizes.size() && _sortEncodedSizes[0]) return;
+
   ClauseList::Iterator cit(_groundClauses);
 
   // Note ground clauses will consist of propositional symbols only due to flattening
@@ -938,8 +1103,7 @@ void FiniteModelBuilder::addGroundClauses()
         SATLiteral slit = getSATLiteral(f,emptyGrounding,(*c)[i]->polarity(),false);
         satClauseLits.push(slit);
       }
-      SATClause* satCl = SATClause::fromStack(satClauseLits);
-      addSATClause(satCl);
+      addSATClause(satClauseLits);
   }
 }
 
@@ -987,6 +1151,8 @@ void FiniteModelBuilder::addNewInstances()
     const DArray<unsigned>* varSorts = _clauseVariableSorts.get(c) ;
     static DArray<unsigned> maxVarSize;
     maxVarSize.ensure(vars);
+    static DArray<unsigned> encodedVarSize;
+    encodedVarSize.ensure(vars);
 
     if(!varSorts){
       // this means that the clause consists only of variable equalities
@@ -1009,6 +1175,7 @@ void FiniteModelBuilder::addNewInstances()
       unsigned srt = (*varSorts)[var];
       //cout << "srt="<<srt;
       maxVarSize[var] = min(_sortModelSizes[srt],_sortedSignature->sortBounds[srt]);
+      encodedVarSize[var] = min(_sortEncodedSizes[srt],_sortedSignature->sortBounds[srt]);
       //cout << ",max="<<maxVarSize[var] << endl;
 
       if (!_xmass) {
@@ -1019,6 +1186,9 @@ void FiniteModelBuilder::addNewInstances()
       }
     }
     
+    DArray<LiteralTemplate>& tmpl = *_clauseTemplates.get(c);
+    prepareClauseTemplate(tmpl);
+
     static DArray<unsigned> grounding;
     grounding.ensure(vars);
 
@@ -1034,6 +1204,10 @@ instanceLabel:
       } 
       else{
         grounding[var]++;
+        if(isEncodedGrounding(grounding,encodedVarSize,vars)){
+          // added for smaller sizes already
+          goto instanceLabel;
+        }
         // Grounding represents a new instance
         static SATLiteralStack satClauseLits;
         satClauseLits.reset();
@@ -1081,53 +1255,28 @@ instanceLabel:
         }
 
         // Ground and translate each literal into a SATLiteral
-        for(unsigned lindex=0;lindex<c->length();lindex++){
-          Literal* lit = (*c)[lindex];
+        for(unsigned lindex=0;lindex<tmpl.size();lindex++){
+          const LiteralTemplate& lt = tmpl[lindex];
 
           // check cases where literal is x=y
-          if(lit->isTwoVarEquality()){
-            bool equal = grounding[lit->nthArgument(0)->var()] == grounding[lit->nthArgument(1)->var()]; 
-            if((lit->isPositive() && equal) || (!lit->isPositive() && !equal)){
+          if(lt.twoVarEq){
+            bool equal = grounding[lt.vars[0]] == grounding[lt.vars[1]];
+            if(lt.polarity == equal){
               //Skip instance
-              goto instanceLabel; 
-            } 
-            if((lit->isPositive() && !equal) || (!lit->isPositive() && equal)){
-              //Skip literal
-              continue;
+              goto instanceLabel;
             }
+            //Skip literal
+            continue;
           }
-          if(lit->isEquality()){
-            ASS(lit->nthArgument(0)->isTerm());
-            ASS(lit->nthArgument(1)->isVar());
-            Term* t = lit->nthArgument(0)->term();
-            unsigned functor = t->functor();
-            unsigned arity = t->arity();
-            static DArray<unsigned> use;
-            use.ensure(arity+1);
-
-            for(unsigned j=0;j<arity;j++){
-              ASS(t->nthArgument(j)->isVar());
-              use[j] = grounding[t->nthArgument(j)->var()];
-            }
-            use[arity]=grounding[lit->nthArgument(1)->var()];
-            satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),true));
-            
-          }else{
-            unsigned functor = lit->functor();
-            unsigned arity = lit->arity();
-            static DArray<unsigned> use;
-            use.ensure(arity);
-
-            for(unsigned j=0;j<arity;j++){
-              ASS(lit->nthArgument(j)->isVar());
-              use[j] = grounding[lit->nthArgument(j)->var()];
-            }
-            satClauseLits.push(getSATLiteral(functor,use,lit->polarity(),false));
+
+          unsigned satVar = lt.base;
+          for(unsigned j=0;j<lt.vars.size();j++){
+            satVar += lt.mults[j]*(grounding[lt.vars[j]]-1);
           }
+          satClauseLits.push(SATLiteral(satVar,lt.polarity));
         }
      
-        SATClause* satCl = SATClause::fromStack(satClauseLits);
-        addSATClause(satCl);
+        addSATClause(satClauseLits);
 
         goto instanceLabel;
       }
@@ -1184,16 +1333,21 @@ void FiniteModelBuilder::addNewFunctionalDefs()
     const DArray<unsigned>& f_signature = _sortedSignature->functionSignatures[f];
     static DArray<unsigned> maxVarSize;
     maxVarSize.ensure(arity+2);
+    static DArray<unsigned> encodedVarSize;
+    encodedVarSize.ensure(arity+2);
 
     // find max size of y and z 
     unsigned returnSrt = f_signature[arity];
     maxVarSize[0] = min(_sortedSignature->sortBounds[returnSrt],_sortModelSizes[returnSrt]);
     maxVarSize[1] = min(_sortedSignature->sortBounds[returnSrt],_sortModelSizes[returnSrt]);
+    encodedVarSize[0] = min(_sortedSignature->sortBounds[returnSrt],_sortEncodedSizes[returnSrt]);
+    encodedVarSize[1] = encodedVarSize[0];
 
     // we skip 0 and 1 as these are y and z
     for(unsigned var=2;var<arity+2;var++){
       unsigned srt = f_signature[var-2]; // f_signature[arity] is return sort
       maxVarSize[var] = min(_sortedSignature->sortBounds[srt],_sortModelSizes[srt]);
+      encodedVarSize[var] = min(_sortedSignature->sortBounds[srt],_sortEncodedSizes[srt]);
     }
 
     static DArray<unsigned> grounding;
@@ -1218,6 +1372,10 @@ newFuncLabel:
             //Skip this instance
             goto newFuncLabel;
           }
+          if(isEncodedGrounding(grounding,encodedVarSize,arity+2)){
+            // added for smaller sizes already
+            goto newFuncLabel;
+          }
           static SATLiteralStack satClauseLits;
           satClauseLits.reset();
 
@@ -1233,8 +1391,7 @@ newFuncLabel:
           use[arity]=grounding[1];
           satClauseLits.push(getSATLiteral(f,use,false,true)); 
 
-          SATClause* satCl = SATClause::fromStack(satClauseLits);
-          addSATClause(satCl);
+          addSATClause(satClauseLits);
           goto newFuncLabel;
         }
       }
@@ -1267,8 +1424,8 @@ void FiniteModelBuilder::addNewSymmetryOrderingAxioms(unsigned size,
     SATLiteral sl = getSATLiteral(gt.f,grounding,true,true);
     satClauseLits.push(sl);
   }
-  SATClause* satCl = SATClause::fromStack(satClauseLits);
-  addSATClause(satCl);
+  addSymmetryGuard(satClauseLits);
+  addSATClause(satClauseLits);
 
 }
 
@@ -1313,11 +1470,23 @@ void FiniteModelBuilder::addNewSymmetryCanonicityAxioms(unsigned size,
 
         satClauseLits.push(getSATLiteral(gtj.f,grounding_j,true,true));
       }
-      addSATClause(SATClause::fromStack(satClauseLits));
+      addSymmetryGuard(satClauseLits);
+      addSATClause(satClauseLits);
   }
 
 }
 
+void FiniteModelBuilder::addSymmetryGuard(SATLiteralStack& satClauseLits)
+{
+  CALL("FiniteModelBuilder::addSymmetryGuard");
+
+  if(!_xmass) return;
+
+  // the groundings ordered by createSymmetryOrdering differ between sizes, so
+  // the axioms of the earlier sizes must be switched off in a kept solver
+  satClauseLits.push(SATLiteral(_symmetryActivationVar,0));
+}
+
 void FiniteModelBuilder::addUseModelSize(unsigned size)
 {
   CALL("FiniteModelBuilder::addUseModelSize");
@@ -1353,7 +1522,7 @@ void FiniteModelBuilder::addUseModelSize(unsigned size)
     }
   }
 
-  addSATClause(SATClause::fromStack(satClauseLits));
+  addSATClause(satClauseLits);
 */
 }
 
@@ -1364,20 +1533,35 @@ void FiniteModelBuilder::addNewTotalityDefs()
   if (_xmass) {
     // make sure to solve the problem of some sorts not growing all the way to _sortModelSizes[srt], because of _sortedSignature->sortBounds[srt]
     for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
-      // for every sort
-      for (unsigned j = 0; j < _distinctSortSizes[i]-1; j++) {
+      // for every sort (a kept solver already has the clauses up to the previous size)
+      unsigned encoded = _distinctSortEncodedSizes[i];
+      for (unsigned j = encoded ? encoded-1 : 0; j < _distinctSortSizes[i]-1; j++) {
         // for every domain size j have clause: not marker(j+1) | marker(j)
         // which says: "d > j+2" -> "d > j+1"
         static SATLiteralStack satClauseLits;
         satClauseLits.reset();
         satClauseLits.push(SATLiteral(marker_offsets[i]+j,1));
         satClauseLits.push(SATLiteral(marker_offsets[i]+j+1,0));
-        SATClause* satCl = SATClause::fromStack(satClauseLits);
-        addSATClause(satCl);
+        addSATClause(satClauseLits);
       }
     }
   }
 
+  // Whether a kept solver already has the version for size i of a totality clause,
+  // i.e. it was added for the same arguments before and with the same marker
+  auto isEncodedVersion = [this](bool argsEncoded, unsigned i, unsigned maxSize, unsigned encodedMaxSize, unsigned dsrt) {
+    if(!argsEncoded || i > encodedMaxSize) {
+      return false;
+    }
+    if(_sortedSignature->monotonicSorts[dsrt] && i != encodedMaxSize) {
+      // only the weakest one was added
+      return false;
+    }
+    unsigned marker_idx = (i == maxSize) ? _distinctSortSizes[dsrt]-1 : i-1;
+    unsigned encoded_marker_idx = (i == encodedMaxSize) ? _distinctSortEncodedSizes[dsrt]-1 : i-1;
+    return marker_idx == encoded_marker_idx;
+  };
+
   for(unsigned f=0;f<env.signature->functions();f++){
     if(del_f[f]) continue;
     unsigned arity = env.signature->functionArity(f);
@@ -1392,10 +1576,14 @@ void FiniteModelBuilder::addNewTotalityDefs()
       unsigned srt = f_signature[0];
       unsigned dsrt = _sortedSignature->parents[srt];
       unsigned maxSize = min(_sortedSignature->sortBounds[srt],_sortModelSizes[srt]);
+      unsigned encodedMaxSize = min(_sortedSignature->sortBounds[srt],_sortEncodedSizes[srt]);
 
       // cout << "Totality for const " << f << " of sort " << srt << " and max size " << maxSize << endl;
 
       for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dsrt])) ? maxSize : 1; i <= maxSize; i++) { // just the weakest one, if monotonic
+        if (isEncodedVersion(true,i,maxSize,encodedMaxSize,dsrt)) {
+          continue;
+        }
         static SATLiteralStack satClauseLits;
         satClauseLits.reset();
 
@@ -1414,8 +1602,7 @@ void FiniteModelBuilder::addNewTotalityDefs()
           satClauseLits.push(SATLiteral(totalityMarker_offset+dsrt,0));
         }
 
-        SATClause* satCl = SATClause::fromStack(satClauseLits);
-        addSATClause(satCl);
+        addSATClause(satClauseLits);
       }
 
       continue;
@@ -1423,13 +1610,17 @@ void FiniteModelBuilder::addNewTotalityDefs()
 
     static DArray<unsigned> maxVarSize;
     maxVarSize.ensure(arity);
+    static DArray<unsigned> encodedVarSize;
+    encodedVarSize.ensure(arity);
     for(unsigned var=0;var<arity;var++){
       unsigned srt = f_signature[var]; 
       maxVarSize[var] = min(_sortedSignature->sortBounds[srt],_sortModelSizes[srt]);
+      encodedVarSize[var] = min(_sortedSignature->sortBounds[srt],_sortEncodedSizes[srt]);
     }
     unsigned retSrt = f_signature[arity];
     unsigned dRetSrt = _sortedSignature->parents[retSrt];
     unsigned maxRtSrtSize = min(_sortedSignature->sortBounds[retSrt],_sortModelSizes[retSrt]);
+    unsigned encodedRtSrtSize = min(_sortedSignature->sortBounds[retSrt],_sortEncodedSizes[retSrt]);
 
     static DArray<unsigned> grounding;
     grounding.ensure(arity);
@@ -1448,7 +1639,11 @@ newTotalLabel:
           //for(unsigned j=0;j<grounding.size();j++) cout << grounding[j] << " ";
           //cout << endl;
 
+          bool argsEncoded = isEncodedGrounding(grounding,encodedVarSize,arity);
           for (unsigned i = (!_xmass || (_sortedSignature->monotonicSorts[dRetSrt])) ? maxRtSrtSize : 1; i <= maxRtSrtSize; i++) {
+            if (isEncodedVersion(argsEncoded,i,maxRtSrtSize,encodedRtSrtSize,dRetSrt)) {
+              continue;
+            }
             static SATLiteralStack satClauseLits;
             satClauseLits.reset();
 
@@ -1465,8 +1660,7 @@ newTotalLabel:
             } else {
               satClauseLits.push(SATLiteral(totalityMarker_offset+dRetSrt,0));
             }
-            SATClause* satCl = SATClause::fromStack(satClauseLits);
-            addSATClause(satCl);
+            addSATClause(satClauseLits);
           }
           goto newTotalLabel;
         }
@@ -1508,25 +1702,29 @@ SATLiteral FiniteModelBuilder::getSATLiteral(unsigned f, const DArray<unsigned>&
   for(unsigned i=0;i<grounding.size();i++){
     var += mult*(grounding[i]-1);
     unsigned srt = signature[i];
-    //cout << var << ", " << mult << "," << _sortModelSizes[srt] << endl;
-    mult *= _sortModelSizes[srt];
+    //cout << var << ", " << mult << "," << _sortLayoutSizes[srt] << endl;
+    mult *= _sortLayoutSizes[srt];
   }
   //cout << "return " << var << endl;
 
   return SATLiteral(var,polarity);
 }
 
-void FiniteModelBuilder::addSATClause(SATClause* cl)
+void FiniteModelBuilder::addSATClause(const SATLiteralStack& satClauseLits)
 {
   CALL("FiniteModelBuilder::addSATClause");
-  cl = Preprocess::removeDuplicateLiterals(cl);
-  if(!cl){ return; }
 #if VTRACE_FMB
-  cout << "ADDING " << cl->toString() << endl; // " of size " << cl->length() << endl;
+  cout << "ADDING";
+  for(unsigned i=0;i<satClauseLits.size();i++){
+    cout << " " << satClauseLits[i].toString();
+  }
+  cout << endl;
 #endif
 
-  _clausesToBeAdded.push(cl);
-
+  // no SATClause objects are created, the solver copies the literals into its own clause database
+  // (and takes care of duplicate literals and tautologies)
+  _solver->addClause(satClauseLits);
+  _clausesAdded++;
 }
 
 MainLoopResult FiniteModelBuilder::runImpl()
@@ -1594,8 +1792,10 @@ MainLoopResult FiniteModelBuilder::runImpl()
 
     {
     TimeCounter tc(TC_FMB_CONSTRAINT_CREATION);
+    int groundingStart = env.timer->elapsedMilliseconds();
+    _clausesAdded = 0;
 
-    // add the new clauses to _clausesToBeAdded
+    // generate the new clauses and pass them to the SAT solver as they come
 #if VTRACE_FMB
     cout << "GROUND" << endl;
 #endif
@@ -1618,16 +1818,18 @@ MainLoopResult FiniteModelBuilder::runImpl()
 #endif
     addNewTotalityDefs();
 
+    env.statistics->fmbGroundClauses += _clausesAdded;
+    env.statistics->fmbGroundingTime += env.timer->elapsedMilliseconds()-groundingStart;
     }
 
 #if VTRACE_FMB
     cout << "SOLVING" << endl;
 #endif
-    //TODO consider adding clauses directly to SAT solver in new interface?
-    // pass clauses and assumption to SAT Solver
-    {
-      TimeCounter tc(TC_FMB_SAT_SOLVING);
-      _solver->addClausesIter(pvi(SATClauseStack::ConstIterator(_clausesToBeAdded)));
+    for(unsigned s=0;s<_sortModelSizes.size();s++){
+      _sortEncodedSizes[s] = _sortModelSizes[s];
+    }
+    for(unsigned i=0;i<_distinctSortSizes.size();i++){
+      _distinctSortEncodedSizes[i] = _distinctSortSizes[i];
     }
 
     SATSolver::Status satResult = SATSolver::UNKNOWN;
@@ -1642,6 +1844,7 @@ MainLoopResult FiniteModelBuilder::runImpl()
           assumptions.push(SATLiteral(marker_offsets[i]+_distinctSortSizes[i]-1,0));
           // cout << "assuming sort " << i << " value " << _distinctSortSizes[i]-1 << " negative" << endl;
         }
+        assumptions.push(SATLiteral(_symmetryActivationVar,1));
       } else {
         for (unsigned i = 0; i < _distinctSortSizes.size(); i++) {
           assumptions.push(SATLiteral(totalityMarker_offset+i,1));
@@ -1663,16 +1866,7 @@ MainLoopResult FiniteModelBuilder::runImpl()
 
     static unsigned numberOfSatCalls = 0;
     numberOfSatCalls++;
-    unsigned clauseSetSize = _clausesToBeAdded.size();
-    unsigned weight = clauseSetSize;
-
-    // destroy the clauses
-    SATClauseStack::Iterator it(_clausesToBeAdded);
-    while (it.hasNext()) {
-      it.next()->destroy();
-    }
-    // but the container needs to be empty for the next round in any case
-    _clausesToBeAdded.reset();
+    unsigned weight = _clausesAdded;
 
     {
       // _solver->explicitlyMinimizedFailedAssumptions(false,true); // TODO: try adding this in
@@ -1688,6 +1882,11 @@ MainLoopResult FiniteModelBuilder::runImpl()
         for (unsigned i = 0; i < failed.size(); i++) {
           unsigned var = failed[i].var();
 
+          if (var == _symmetryActivationVar) {
+            // symmetry breaking is valid for any size
+            continue;
+          }
+
           unsigned srt = which_sort(var);
 
           // cout << "which_sort(var) = " << srt << endl;
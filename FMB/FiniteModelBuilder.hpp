@@ -26,7 +26,7 @@
 #endif
 
 #include "Kernel/MainLoop.hpp"
-#include "SAT/SATSolver.hpp"
+#include "SAT/MinisatInterfacingNewSimp.hpp"
 #include "Lib/ScopedPtr.hpp"
 #include "SortInference.hpp"
 #include "Lib/BinaryHeap.hpp"
@@ -98,11 +98,19 @@ private:
   void addNewSymmetryOrderingAxioms(unsigned modelSize,Stack<GroundedTerm>& groundedTerms); 
   // Add constraints for canonicity of symmetry order i.e. if a groundedTerm uses a constant smaller terms use smaller constants
   void addNewSymmetryCanonicityAxioms(unsigned modelSize,Stack<GroundedTerm>& groundedTerms,unsigned maxModelSize);
+  // The symmetry axioms depend on the current sizes, with the contour encoding (and a kept
+  // solver) they are therefore only enabled by assuming the current _symmetryActivationVar
+  void addSymmetryGuard(SATLiteralStack& satClauseLits);
+  unsigned _symmetryActivationVar;
 
   // Add all symmetry constraints
   // For each model size up to the maximum add both ordering and canonicity constraints for each (inferred) sort
   void addNewSymmetryAxioms(){
       ASS(_sortedSignature);
+
+    if(_xmass){
+      _symmetryActivationVar = _solver->newVar();
+    }
     
     for(unsigned s=0;s<_sortedSignature->sorts;s++){
       //cout << "SORT " << s << endl;
@@ -126,14 +134,17 @@ private:
 
   // resets all structures and SAT solver using _sortModelSizes 
   bool reset();
+  // computes the SAT variable offsets for _distinctSortLayoutSizes, false on overflow
+  bool computeVariableLayout(unsigned& offsets);
 
   // make the symmetry orderings
   void createSymmetryOrdering();
   // The per-sort ordering of grounded terms used for symmetry breaking
   DArray<Stack<GroundedTerm>> _sortedGroundedTerms;
 
-  // SAT solver used to solve constraints (a new one is used for each model size)
-  ScopedPtr<SATSolverWithAssumptions> _solver;
+  // SAT solver used to solve constraints (a new one is used for each model size,
+  // unless the domains still fit into the variable layout of the contour encoding, see reset())
+  ScopedPtr<MinisatInterfacingNewSimp> _solver;
 
   // Structures to record symbols removed during preprocessing i.e. via definition elimination
   // These are ignored throughout finite model building and then the definitions (recorded here)
@@ -146,17 +157,17 @@ private:
   DArray<unsigned> del_f;
   DArray<unsigned> del_p;
 
-  // Add a SATClause to the SAT solver
-  void addSATClause(SATClause* cl);
-  // Add a singleton SATClause in the form of a SATLiteral to the SAT solver
+  // Pass a clause, given by its literals, straight to the SAT solver
+  void addSATClause(const SATLiteralStack& satClauseLits);
+  // Add a singleton clause in the form of a SATLiteral to the SAT solver
   void addSATClause(SATLiteral lit){
     static SATLiteralStack satClauseLits;
     satClauseLits.reset();
     satClauseLits.push(lit);
-    addSATClause(SATClause::fromStack(satClauseLits));
+    addSATClause(satClauseLits);
   }
-  // SAT clauses to be added. We record them so we can delete them after calling the SAT solver
-  SATClauseStack _clausesToBeAdded;
+  // Number of clauses passed to the SAT solver in the current round
+  unsigned _clausesAdded;
 
   // The inferred signature of sorts (see SortInference.hpp)
   SortedSignature* _sortedSignature;
@@ -170,18 +181,50 @@ private:
   // As clauses are normalized variables will be numbered 0,1,...
   DHMap<Clause*,DArray<unsigned>*> _clauseVariableSorts;
 
+  // A literal of a flattened clause, pre-digested for grounding
+  // i.e. a literal p(x,y), f(x)=y or x=y with the clause variable at each position
+  struct LiteralTemplate {
+    unsigned symbol;
+    bool isFunction;
+    bool polarity;
+    // x=y literals do not translate to SAT literals, they discard the literal or the instance
+    bool twoVarEq;
+    // clause variable at each grounding position (for functions the last one is the result)
+    DArray<unsigned> vars;
+    // SAT variable of the first grounding and the multiplier of each position,
+    // valid for the current _sortLayoutSizes (see prepareClauseTemplate)
+    unsigned base;
+    DArray<unsigned> mults;
+  };
+  // The templates are built once in init() from the flattened clauses
+  // and reused for every domain size assignment
+  DHMap<Clause*,DArray<LiteralTemplate>*> _clauseTemplates;
+
+  void createClauseTemplate(Clause* c);
+  void prepareClauseTemplate(DArray<LiteralTemplate>& tmpl);
+
   // There is a implicit mapping from ground terms to SAT variables
   // These offsets give the SAT variable for the *first* grounding of each function or predicate symbol
   // Then the SAT variables for other groundings can be computed from this
   DArray<unsigned> f_offsets;
   DArray<unsigned> p_offsets;
 
+  // The sizes the offsets (and the multipliers of the positions) are computed for.
+  // Normally these are just the _sortModelSizes, but the contour encoding leaves room
+  // for the domains to grow, so that the SAT solver (with everything it has learned)
+  // can be kept and only the clauses mentioning the new domain elements need to be added
+  DArray<unsigned> _sortLayoutSizes;
+  DArray<unsigned> _distinctSortLayoutSizes;
+  // The sizes for which the clauses are already in the current _solver (0 for a new solver)
+  DArray<unsigned> _sortEncodedSizes;
+  DArray<unsigned> _distinctSortEncodedSizes;
+
   // do contour encoding instead of point-wise
   bool _xmass;
 
   // if (_xmass) {
 
-  /* Each distinctSort has as many markers as is its current size.
+  /* Each distinctSort has as many markers as is its layout size.
    * Their offsets are stored on per sort basis.
    */
   DArray<unsigned> marker_offsets;
@@ -321,6 +321,7 @@ class Splitter;
 class ConsequenceFinder;
 class LabelFinder;
 class SymElOutput;
+class SaturationTrace;
 }
 
 namespace Inferences
@@ -55,6 +55,22 @@ GroundingIndex::GroundingIndex(const Options& opt)
   _grounder = new GlobalSubsumptionGrounder(_solver.ptr());
 }
 
+/**
+ * Return the variable of our solver standing for the split level @b lev,
+ * introducing a fresh one if there is none yet.
+ */
+unsigned GroundingIndex::splitLevelToVar(unsigned lev)
+{
+  CALL("GroundingIndex::splitLevelToVar");
+
+  unsigned* pvar;
+  if(_splits2vars.getValuePtr(lev, pvar)) {
+    *pvar = _solver->newVar();
+    ALWAYS(_vars2splits.insert(*pvar,lev));
+  }
+  return *pvar;
+}
+
 void GroundingIndex::handleClause(Clause* c, bool adding)
 {
   CALL("GroundingIndex::handleClause");
@@ -20,6 +20,7 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DHMap.hpp"
 #include "Lib/ScopedPtr.hpp"
 
 #include "SAT/SATSolver.hpp"
@@ -41,12 +42,30 @@ public:
   SATSolverWithAssumptions& getSolver() { return *_solver; }
   GlobalSubsumptionGrounder& getGrounder() { return *_grounder; }
 
+  unsigned splitLevelToVar(unsigned lev);
+  /**
+   * Return true if @b var stands for an AVATAR split level in our solver
+   * and assign the level to @b lev.
+   */
+  bool isSplitLevelVar(unsigned var, unsigned& lev) const {
+    return _vars2splits.find(var,lev);
+  }
+
 protected:
   virtual void handleClause(Clause* c, bool adding);
 
 private:
   ScopedPtr<SATSolverWithAssumptions> _solver;
   ScopedPtr<GlobalSubsumptionGrounder> _grounder;
+
+  /**
+   * Variables of _solver are shared by two namespaces: those
+   * introduced by _grounder for ground literals and those standing
+   * for AVATAR split levels. The latter are recorded here, in both
+   * directions.
+   */
+  DHMap<unsigned, unsigned> _splits2vars;
+  DHMap<unsigned, unsigned> _vars2splits;
 };
 
 }
@@ -123,13 +123,16 @@ public:
   virtual ~Index();
 
   void attachContainer(ClauseContainer* cc);
+
+  /** Number of clauses of the attached container that were passed to the index */
+  unsigned clauseCount() const { return _clauseCount; }
 protected:
-  Index() {}
+  Index() : _clauseCount(0) {}
 
   void onAddedToContainer(Clause* c)
-  { handleClause(c, true); }
+  { _clauseCount++; handleClause(c, true); }
   void onRemovedFromContainer(Clause* c)
-  { handleClause(c, false); }
+  { _clauseCount--; handleClause(c, false); }
 
   virtual void handleClause(Clause* c, bool adding) {}
 
@@ -138,6 +141,7 @@ protected:
 private:
   SubscriptionData _addedSD;
   SubscriptionData _removedSD;
+  unsigned _clauseCount;
 };
 
 
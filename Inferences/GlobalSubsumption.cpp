@@ -78,6 +78,35 @@ void GlobalSubsumption::detach()
   ForwardSimplificationEngine::detach();
 }
 
+/**
+ * Return the assumptions activating the split levels which are
+ * currently true in the AVATAR model.
+ *
+ * The stack is only recollected when the Splitter reports a model change,
+ * instead of scanning all split levels for every performed clause.
+ */
+const SATLiteralStack& GlobalSubsumption::getFullModelAssumptions()
+{
+  CALL("GlobalSubsumption::getFullModelAssumptions");
+  ASS(_splitter);
+
+  unsigned version = _splitter->activeLevelsVersion();
+  if (version == _fullModelAssumpsVersion) {
+    return _fullModelAssumps;
+  }
+
+  _fullModelAssumps.reset();
+  SplitLevel bound = _splitter->splitLevelBound();
+  for (SplitLevel lev = 0; lev < bound; lev++) {
+    if (_splitter->splitLevelActive(lev)) {
+      unsigned var = _index->splitLevelToVar(lev);
+      _fullModelAssumps.push(SATLiteral(var,true)); // positive
+    }
+  }
+  _fullModelAssumpsVersion = version;
+  return _fullModelAssumps;
+}
+
 /**
  * Perform GS on cl and return the reduced clause,
  * or cl itself if GS does not reduce.
@@ -132,7 +161,7 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
     SplitSet::Iterator sit(*cl->splits());
     while(sit.hasNext()) {
       SplitLevel l = sit.next();      
-      unsigned var = splitLevelToVar(l);
+      unsigned var = _index->splitLevelToVar(l);
                 
       plits.push(SATLiteral(var,false)); // negative
       if (!_splitter) {
@@ -144,13 +173,10 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
   // for gsaa=full_model, assume all active split levels instead
   if (_splitter) {
     ASS(_splittingAssumps);
-    
-    SplitLevel bound = _splitter->splitLevelBound();
-    for (SplitLevel lev = 0; lev < bound; lev++) {
-      if (_splitter->splitLevelActive(lev)) {
-        unsigned var = splitLevelToVar(lev);
-        assumps.push(SATLiteral(var,true)); // positive
-      }
+
+    const SATLiteralStack& active = getFullModelAssumptions();
+    for (unsigned i = 0; i < active.size(); i++) {
+      assumps.push(active[i]);
     }
   }
   
@@ -224,7 +250,7 @@ Clause* GlobalSubsumption::perform(Clause* cl, Stack<Unit*>& prems)
             for (unsigned i = 0; i < prem_sz; i++ ) {
               SATLiteral lit = (*prem)[i];
               SplitLevel lev;
-              if (isSplitLevelVar(lit.var(),lev)) {
+              if (_index->isSplitLevelVar(lit.var(),lev)) {
                 ASS(lit.isNegative());
                 if (!splitAssumps.contains(lit)) {
                   return false;
@@ -44,7 +44,7 @@ public:
       _explicitMinim(opts.globalSubsumptionExplicitMinim()!=Options::GlobalSubsumptionExplicitMinim::OFF),
       _randomizeMinim(opts.globalSubsumptionExplicitMinim()==Options::GlobalSubsumptionExplicitMinim::RANDOMIZED),
       _splittingAssumps(opts.globalSubsumptionAvatarAssumptions()!= Options::GlobalSubsumptionAvatarAssumptions::OFF),
-      _splitter(0) {}
+      _splitter(0), _fullModelAssumpsVersion(UINT_MAX) {}
 
   /**
    * The attach function must not be called when this constructor is used.
@@ -90,36 +90,14 @@ private:
   Splitter* _splitter;
   
   /**
-   * A map binding split levels to variables assigned to them in our SAT solver.
-   * 
-   * (Should this be rather a part of _index?)
+   * For gsaa=full_model, the assumptions corresponding to the split levels
+   * active in the current AVATAR model, together with the Splitter's
+   * activeLevelsVersion() they were collected for.
    */
-  DHMap<unsigned, unsigned> _splits2vars;
-  
-  /**
-   * An inverse of the above map, for convenience.
-   */  
-  DHMap<unsigned, unsigned> _vars2splits;
-      
-protected:  
-  unsigned splitLevelToVar(SplitLevel lev) {        
-    CALL("GlobalSubsumption::splitLevelToVar");
-    unsigned* pvar;
-              
-    if(_splits2vars.getValuePtr(lev, pvar)) {
-      SATSolver& solver = _index->getSolver();
-      *pvar = solver.newVar();
-      ALWAYS(_vars2splits.insert(*pvar,lev));
-    }
-    
-    return *pvar;
-  }  
-  
-  bool isSplitLevelVar(unsigned var, SplitLevel& lev) {
-    CALL("GlobalSubsumption::isSplitLevelVar");
-    
-    return _vars2splits.find(var,lev);
-  }
+  SATLiteralStack _fullModelAssumps;
+  unsigned _fullModelAssumpsVersion;
+
+  const SATLiteralStack& getFullModelAssumptions();
 };
 
 };
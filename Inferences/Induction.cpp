@@ -245,16 +245,52 @@ void InductionClauseIterator::process(Clause* premise, Literal* lit)
    }
 }
 
-void InductionClauseIterator::produceClauses(Clause* premise, Literal* origLit, Formula* hypothesis, Literal* conclusion, InferenceRule rule, ResultSubstitutionSP& substitution)
+/**
+ * Rebuild the term @b t with the function symbols in @b functions renamed
+ */
+static TermList renameFunctions(TermList t, DHMap<unsigned,unsigned>& functions)
+{
+  CALL("renameFunctions");
+
+  if(t.isVar()){
+    return t;
+  }
+  Term* trm = t.term();
+  unsigned f;
+  bool changed = functions.find(trm->functor(),f);
+  if(!changed){
+    f = trm->functor();
+  }
+  Stack<TermList> args;
+  for(unsigned i=0;i<trm->arity();i++){
+    TermList arg = *trm->nthArgument(i);
+    args.push(renameFunctions(arg,functions));
+    changed |= (args.top()!=arg);
+  }
+  if(!changed){
+    return t;
+  }
+  return TermList(Term::create(f,trm->arity(),args.begin()));
+}
+
+void InductionClauseIterator::produceClauses(Clause* premise, Literal* origLit, Schema schema, Literal* lit, Term* term, InferenceRule rule, ResultSubstitutionSP& substitution)
 {
   CALL("InductionClauseIterator::produceClauses");
-  NewCNF cnf(0);
-  cnf.setForInduction();
+
+  SchemaTemplate* templ = getTemplate(schema, term);
+
+  // the hypothesis is still built so that it can appear in proofs, but it is
+  // not clausified again, the clauses are instances of the template
+  unsigned firstSchemaPred = env.signature->predicates();
+  Literal* conclusion;
+  Formula* hypothesis = buildHypothesis(schema, lit, term, conclusion);
+  ASS_EQ(env.signature->predicates()-firstSchemaPred, templ->schemaPreds);
+
   Stack<Clause*> hyp_clauses;
   Inference inf = NonspecificInference0(UnitInputType::AXIOM,rule);
   inf.setInductionDepth(premise->inference().inductionDepth()+1);
   FormulaUnit* fu = new FormulaUnit(hypothesis,inf);
-  cnf.clausify(NNF::ennf(fu), hyp_clauses);
+  instantiateTemplate(templ, lit, term, firstSchemaPred, fu, hyp_clauses);
 
   // Now perform resolution between origLit and the hyp_clauses on conclusion if conclusion in the clause
   // If conclusion not in the clause then the clause is a definition from clausification and just keep
@@ -276,6 +312,141 @@ void InductionClauseIterator::produceClauses(Clause* premise, Literal* origLit,
   }
 }
 
+/**
+ * Return the clausified @b schema for the sort of @b term, clausifying it on first use
+ *
+ * The hypothesis is built for the literal ~P(term) where P is a fresh placeholder
+ * predicate, so the clauses do not depend on the literal we do induction on.
+ */
+InductionClauseIterator::SchemaTemplate* InductionClauseIterator::getTemplate(Schema schema, Term* term)
+{
+  CALL("InductionClauseIterator::getTemplate");
+
+  static DHMap<pair<unsigned,unsigned>,SchemaTemplate*> templates;
+  unsigned srt = env.signature->getFunction(term->functor())->fnType()->result();
+  pair<unsigned,unsigned> key(static_cast<unsigned>(schema),srt);
+
+  SchemaTemplate* templ;
+  if(templates.find(key,templ)){
+    return templ;
+  }
+
+  templ = new SchemaTemplate();
+  templ->placeholder = env.signature->addFreshPredicate(1,"indPlaceholder");
+  env.signature->getPredicate(templ->placeholder)->setType(OperatorType::getPredicateType({srt}));
+  Literal* lit = Literal::create1(templ->placeholder,false,TermList(term));
+
+  templ->firstSchemaPred = env.signature->predicates();
+  Literal* conclusion;
+  Formula* hypothesis = buildHypothesis(schema, lit, term, conclusion);
+  templ->schemaPreds = env.signature->predicates()-templ->firstSchemaPred;
+
+  unsigned firstFun = env.signature->functions();
+  unsigned firstPred = env.signature->predicates();
+  NewCNF cnf(0);
+  cnf.setForInduction();
+  FormulaUnit* fu = new FormulaUnit(hypothesis,NonspecificInference0(UnitInputType::AXIOM,InferenceRule::INDUCTION_AXIOM));
+  cnf.clausify(NNF::ennf(fu), templ->clauses);
+
+  for(unsigned f=firstFun;f<env.signature->functions();f++){
+    templ->skolemFunctions.push(f);
+  }
+  for(unsigned p=firstPred;p<env.signature->predicates();p++){
+    templ->skolemPredicates.push(p);
+  }
+
+  templates.insert(key,templ);
+  return templ;
+}
+
+/**
+ * Add to @b acc the clauses of @b templ with the placeholder replaced by the
+ * complement of @b lit (with @b term as the induction term)
+ *
+ * Symbols introduced by the clausification get fresh copies, as the Skolem
+ * functions of different hypotheses must not be shared. Predicates introduced
+ * by building the hypothesis are mapped to those starting at @b firstSchemaPred.
+ */
+void InductionClauseIterator::instantiateTemplate(SchemaTemplate* templ, Literal* lit, Term* term, unsigned firstSchemaPred, FormulaUnit* fu, Stack<Clause*>& acc)
+{
+  CALL("InductionClauseIterator::instantiateTemplate");
+
+  static DHMap<unsigned,unsigned> functions;
+  static DHMap<unsigned,unsigned> predicates;
+  functions.reset();
+  predicates.reset();
+
+  for(unsigned i=0;i<templ->schemaPreds;i++){
+    predicates.insert(templ->firstSchemaPred+i,firstSchemaPred+i);
+  }
+  Stack<unsigned>::BottomFirstIterator fit(templ->skolemFunctions);
+  while(fit.hasNext()){
+    unsigned f = fit.next();
+    Signature::Symbol* sym = env.signature->getFunction(f);
+    unsigned fresh = env.signature->addSkolemFunction(sym->arity());
+    env.signature->getFunction(fresh)->setType(sym->fnType());
+    env.signature->getFunction(fresh)->markInductionSkolem();
+    functions.insert(f,fresh);
+  }
+  Stack<unsigned>::BottomFirstIterator pit(templ->skolemPredicates);
+  while(pit.hasNext()){
+    unsigned p = pit.next();
+    Signature::Symbol* sym = env.signature->getPredicate(p);
+    unsigned fresh = env.signature->addSkolemPredicate(sym->arity());
+    env.signature->getPredicate(fresh)->setType(sym->predType());
+    predicates.insert(p,fresh);
+  }
+
+  Literal* clit = Literal::complementaryLiteral(lit);
+  static Stack<Literal*> lits;
+  static Stack<TermList> args;
+  Stack<Clause*>::BottomFirstIterator cit(templ->clauses);
+  while(cit.hasNext()){
+    Clause* c = cit.next();
+    lits.reset();
+    for(unsigned i=0;i<c->length();i++){
+      Literal* l = (*c)[i];
+      if(l->functor()==templ->placeholder){
+        TermReplacement cr(term,renameFunctions(*l->nthArgument(0),functions));
+        Literal* inst = cr.transform(clit);
+        lits.push(l->isPositive() ? inst : Literal::complementaryLiteral(inst));
+        continue;
+      }
+      args.reset();
+      for(unsigned j=0;j<l->arity();j++){
+        args.push(renameFunctions(*l->nthArgument(j),functions));
+      }
+      unsigned p;
+      if(predicates.find(l->functor(),p)){
+        lits.push(Literal::create(p,l->arity(),l->polarity(),false,args.begin()));
+      }
+      else{
+        lits.push(Literal::create(l,args.begin()));
+      }
+    }
+    acc.push(Clause::fromStack(lits,FormulaTransformation(InferenceRule::CLAUSIFY,fu)));
+  }
+}
+
+Formula* InductionClauseIterator::buildHypothesis(Schema schema, Literal* lit, Term* term, Literal*& conclusion)
+{
+  CALL("InductionClauseIterator::buildHypothesis");
+
+  switch(schema){
+    case Schema::MATH_ONE_UP:
+      return mathInductionOneHypothesis(lit, term, true, conclusion);
+    case Schema::MATH_ONE_DOWN:
+      return mathInductionOneHypothesis(lit, term, false, conclusion);
+    case Schema::STRUCT_ONE:
+      return structInductionOneHypothesis(lit, term, conclusion);
+    case Schema::STRUCT_TWO:
+      return structInductionTwoHypothesis(lit, term, conclusion);
+    case Schema::STRUCT_THREE:
+      return structInductionThreeHypothesis(lit, term, conclusion);
+  }
+  ASSERTION_VIOLATION;
+}
+
 // deal with integer constants using two hypotheses
 // (L[0] & (![X] : (X>=0 & L[X]) -> L[x+1])) -> (![Y] : Y>=0 -> L[Y])
 // (L[0] & (![X] : (X<=0 & L[X]) -> L[x-1])) -> (![Y] : Y<=0 -> L[Y])
@@ -284,6 +455,22 @@ void InductionClauseIterator::performMathInductionOne(Clause* premise, Literal*
 {
   CALL("InductionClauseIterator::performMathInductionOne");
 
+  TermList y(1,false);
+
+  static ScopedPtr<RobSubstitution> subst(new RobSubstitution());
+  // When producing clauses, 'y' should be unified with 'term'
+  subst->unify(TermList(term), 0, y, 1);
+  ResultSubstitutionSP result_subst = ResultSubstitution::fromSubstitution(subst.ptr(), 1, 0);
+  produceClauses(premise, lit, Schema::MATH_ONE_UP, lit, term, rule, result_subst);
+  produceClauses(premise, lit, Schema::MATH_ONE_DOWN, lit, term, rule, result_subst);
+  subst->reset();
+}
+
+// the first (up) or the second (down) hypothesis of performMathInductionOne
+Formula* InductionClauseIterator::mathInductionOneHypothesis(Literal* lit, Term* term, bool up, Literal*& conclusion)
+{
+  CALL("InductionClauseIterator::mathInductionOneHypothesis");
+
   TermList zero(theory->representConstant(IntegerConstantType(0)));
   TermList one(theory->representConstant(IntegerConstantType(1)));
   TermList mone(theory->representConstant(IntegerConstantType(-1)));
@@ -304,23 +491,37 @@ void InductionClauseIterator::performMathInductionOne(Clause* premise, Literal*
   // create L[Y] 
   TermReplacement cr3(term,y);
   Formula* Ly = new AtomicFormula(cr3.transform(clit));
+  conclusion = Ly->literal();
+
+  if(up){
+    // create L[X+1] 
+    TermList fpo(Term::create2(env.signature->getInterpretingSymbol(Theory::INT_PLUS),x,one));
+    TermReplacement cr4(term,fpo);
+    Formula* Lxpo = new AtomicFormula(cr4.transform(clit));
+
+    // create X>=0, which is ~X<0
+    Formula* Lxgz = new AtomicFormula(Literal::create2(env.signature->getInterpretingSymbol(Theory::INT_LESS),
+                                     false,x,zero));
+    // create Y>=0, which is ~Y<0
+    Formula* Lygz = new AtomicFormula(Literal::create2(env.signature->getInterpretingSymbol(Theory::INT_LESS),
+                                     false,y,zero));
 
-  // create L[X+1] 
-  TermList fpo(Term::create2(env.signature->getInterpretingSymbol(Theory::INT_PLUS),x,one));
-  TermReplacement cr4(term,fpo);
-  Formula* Lxpo = new AtomicFormula(cr4.transform(clit));
+    // (L[0] & (![X] : (X>=0 & L[X]) -> L[x+1])) -> (![Y] : Y>=0 -> L[Y])
+
+    return new BinaryFormula(Connective::IMP,
+                    new JunctionFormula(Connective::AND,new FormulaList(Lzero,new FormulaList(
+                      Formula::quantify(new BinaryFormula(Connective::IMP,
+                        new JunctionFormula(Connective::AND, new FormulaList(Lxgz,new FormulaList(Lx,0))),
+                        Lxpo)) 
+                    ,0))),
+                    Formula::quantify(new BinaryFormula(Connective::IMP,Lygz,Ly)));
+  }
 
   // create L[X-1]
   TermList fmo(Term::create2(env.signature->getInterpretingSymbol(Theory::INT_PLUS),x,mone));
   TermReplacement cr5(term,fmo);
   Formula* Lxmo = new AtomicFormula(cr5.transform(clit));
 
-  // create X>=0, which is ~X<0
-  Formula* Lxgz = new AtomicFormula(Literal::create2(env.signature->getInterpretingSymbol(Theory::INT_LESS),
-                                   false,x,zero));
-  // create Y>=0, which is ~Y<0
-  Formula* Lygz = new AtomicFormula(Literal::create2(env.signature->getInterpretingSymbol(Theory::INT_LESS),
-                                   false,y,zero));
   // create X<=0, which is ~0<X
   Formula* Lxlz = new AtomicFormula(Literal::create2(env.signature->getInterpretingSymbol(Theory::INT_LESS),
                                    false,zero,x));
@@ -328,34 +529,15 @@ void InductionClauseIterator::performMathInductionOne(Clause* premise, Literal*
   Formula* Lylz = new AtomicFormula(Literal::create2(env.signature->getInterpretingSymbol(Theory::INT_LESS),
                                    false,zero,y));
 
-
-  // (L[0] & (![X] : (X>=0 & L[X]) -> L[x+1])) -> (![Y] : Y>=0 -> L[Y])
-
-  Formula* hyp1 = new BinaryFormula(Connective::IMP,
-                    new JunctionFormula(Connective::AND,new FormulaList(Lzero,new FormulaList(
-                      Formula::quantify(new BinaryFormula(Connective::IMP,
-                        new JunctionFormula(Connective::AND, new FormulaList(Lxgz,new FormulaList(Lx,0))),
-                        Lxpo)) 
-                    ,0))),
-                    Formula::quantify(new BinaryFormula(Connective::IMP,Lygz,Ly)));
-
   // (L[0] & (![X] : (X<=0 & L[X]) -> L[x-1])) -> (![Y] : Y<=0 -> L[Y])
 
-  Formula* hyp2 = new BinaryFormula(Connective::IMP,
+  return new BinaryFormula(Connective::IMP,
                     new JunctionFormula(Connective::AND,new FormulaList(Lzero,new FormulaList(
                       Formula::quantify(new BinaryFormula(Connective::IMP,
                         new JunctionFormula(Connective::AND, new FormulaList(Lxlz,new FormulaList(Lx,0))),
                         Lxmo))
                     ,0))),
                     Formula::quantify(new BinaryFormula(Connective::IMP,Lylz,Ly)));
-  
-  static ScopedPtr<RobSubstitution> subst(new RobSubstitution());
-  // When producing clauses, 'y' should be unified with 'term'
-  subst->unify(TermList(term), 0, y, 1);
-  ResultSubstitutionSP result_subst = ResultSubstitution::fromSubstitution(subst.ptr(), 1, 0);
-  produceClauses(premise, lit, hyp1, Ly->literal(), rule, result_subst);
-  produceClauses(premise, lit, hyp2, Ly->literal(), rule, result_subst);
-  subst->reset();
 }
 
 void InductionClauseIterator::performMathInductionTwo(Clause* premise, Literal* origLit, Literal* lit, Term* term, InferenceRule rule) 
@@ -374,7 +556,15 @@ void InductionClauseIterator::performMathInductionTwo(Clause* premise, Literal*
 
 void InductionClauseIterator::performStructInductionOne(Clause* premise, Literal* origLit, Literal* lit, Term* term, InferenceRule rule)
 {
-  CALL("InductionClauseIterator::performStructInductionOne"); 
+  CALL("InductionClauseIterator::performStructInductionOne");
+
+  static ResultSubstitutionSP identity = ResultSubstitutionSP(new IdentitySubstitution());
+  produceClauses(premise, origLit, Schema::STRUCT_ONE, lit, term, rule, identity);
+}
+
+Formula* InductionClauseIterator::structInductionOneHypothesis(Literal* lit, Term* term, Literal*& conclusion)
+{
+  CALL("InductionClauseIterator::structInductionOneHypothesis");
 
   TermAlgebra* ta = env.signature->getTermAlgebraOfSort(env.signature->getFunction(term->functor())->fnType()->result());
   unsigned ta_sort = ta->sort();
@@ -446,13 +636,12 @@ void InductionClauseIterator::performStructInductionOne(Clause* premise, Literal
   Formula* indPremise = FormulaList::length(formulas) > 1 ? new JunctionFormula(Connective::AND,formulas)
                                                           : formulas->head();
   TermReplacement cr(term,TermList(var,false));
-  Literal* conclusion = cr.transform(clit);
+  conclusion = cr.transform(clit);
   Formula* hypothesis = new BinaryFormula(Connective::IMP,
                             Formula::quantify(indPremise),
                             Formula::quantify(new AtomicFormula(conclusion)));
 
-  static ResultSubstitutionSP identity = ResultSubstitutionSP(new IdentitySubstitution());
-  produceClauses(premise, origLit, hypothesis, conclusion, rule, identity);
+  return hypothesis;
 }
 
 /**
@@ -460,9 +649,17 @@ void InductionClauseIterator::performStructInductionOne(Clause* premise, Literal
  * We produce the clause ~L[x] \/ ?y : L[y] & !z (z subterm y -> ~L[z])
  * and perform resolution with lit L[c]
  */
-void InductionClauseIterator::performStructInductionTwo(Clause* premise, Literal* origLit, Literal* lit, Term* term, InferenceRule rule) 
+void InductionClauseIterator::performStructInductionTwo(Clause* premise, Literal* origLit, Literal* lit, Term* term, InferenceRule rule)
 {
-  CALL("InductionClauseIterator::performStructInductionTwo"); 
+  CALL("InductionClauseIterator::performStructInductionTwo");
+
+  static ResultSubstitutionSP identity = ResultSubstitutionSP(new IdentitySubstitution());
+  produceClauses(premise, origLit, Schema::STRUCT_TWO, lit, term, rule, identity);
+}
+
+Formula* InductionClauseIterator::structInductionTwoHypothesis(Literal* lit, Term* term, Literal*& conclusion)
+{
+  CALL("InductionClauseIterator::structInductionTwoHypothesis");
 
   TermAlgebra* ta = env.signature->getTermAlgebraOfSort(env.signature->getFunction(term->functor())->fnType()->result());
   unsigned ta_sort = ta->sort();
@@ -531,18 +728,18 @@ void InductionClauseIterator::performStructInductionTwo(Clause* premise, Literal
       
     }
   }
-  Formula* exists = new QuantifiedFormula(Connective::EXISTS, new Formula::VarList(y.var(),0),0,
-                        FormulaList::length(formulas) > 0 ? static_cast<Formula*>(new JunctionFormula(
-                                                                Connective::AND,new FormulaList(new AtomicFormula(Ly),formulas)))
-                                                          : static_cast<Formula*>(new AtomicFormula(Ly)));
+  Formula* body = new AtomicFormula(Ly);
+  if (FormulaList::length(formulas) > 0) {
+    body = new JunctionFormula(Connective::AND,new FormulaList(body,formulas));
+  }
+  Formula* exists = new QuantifiedFormula(Connective::EXISTS, new Formula::VarList(y.var(),0),0,body);
   
   TermReplacement cr2(term,TermList(1,false));
-  Literal* conclusion = cr2.transform(clit);
+  conclusion = cr2.transform(clit);
   FormulaList* orf = new FormulaList(exists,new FormulaList(Formula::quantify(new AtomicFormula(conclusion)),FormulaList::empty()));
   Formula* hypothesis = new JunctionFormula(Connective::OR,orf);
 
-  static ResultSubstitutionSP identity = ResultSubstitutionSP(new IdentitySubstitution());
-  produceClauses(premise, origLit, hypothesis, conclusion, rule, identity);
+  return hypothesis;
 }
 
 /*
@@ -555,10 +752,18 @@ void InductionClauseIterator::performStructInductionTwo(Clause* premise, Literal
  * i.e. we add a new special predicat that is true when its argument is smaller than Y
  *
  */
-void InductionClauseIterator::performStructInductionThree(Clause* premise, Literal* origLit, Literal* lit, Term* term, InferenceRule rule) 
+void InductionClauseIterator::performStructInductionThree(Clause* premise, Literal* origLit, Literal* lit, Term* term, InferenceRule rule)
 {
   CALL("InductionClauseIterator::performStructInductionThree");
 
+  static ResultSubstitutionSP identity = ResultSubstitutionSP(new IdentitySubstitution());
+  produceClauses(premise, origLit, Schema::STRUCT_THREE, lit, term, rule, identity);
+}
+
+Formula* InductionClauseIterator::structInductionThreeHypothesis(Literal* lit, Term* term, Literal*& conclusion)
+{
+  CALL("InductionClauseIterator::structInductionThreeHypothesis");
+
   TermAlgebra* ta = env.signature->getTermAlgebraOfSort(env.signature->getFunction(term->functor())->fnType()->result());
   unsigned ta_sort = ta->sort();
 
@@ -662,12 +867,11 @@ void InductionClauseIterator::performStructInductionThree(Clause* premise, Liter
                        new JunctionFormula(Connective::AND,conjunction));
 
   TermReplacement cr3(term,x);
-  Literal* conclusion = cr3.transform(clit);
+  conclusion = cr3.transform(clit);
   FormulaList* orf = new FormulaList(exists,new FormulaList(Formula::quantify(new AtomicFormula(conclusion)),0));
   Formula* hypothesis = new JunctionFormula(Connective::OR,orf);
 
-  static ResultSubstitutionSP identity = ResultSubstitutionSP(new IdentitySubstitution());
-  produceClauses(premise, origLit, hypothesis, conclusion, rule, identity);
+  return hypothesis;
 }
 
 bool InductionClauseIterator::notDone(Literal* lit, Term* term)
@@ -105,9 +105,45 @@ public:
   }
 
 private:
+  enum class Schema : unsigned {
+    MATH_ONE_UP,
+    MATH_ONE_DOWN,
+    STRUCT_ONE,
+    STRUCT_TWO,
+    STRUCT_THREE
+  };
+
+  /**
+   * A schema clausified once for a sort. The literal we do induction on
+   * is represented by the @c placeholder predicate applied to the term
+   * that stands for the induction term.
+   */
+  struct SchemaTemplate {
+    CLASS_NAME(InductionClauseIterator::SchemaTemplate);
+    USE_ALLOCATOR(InductionClauseIterator::SchemaTemplate);
+
+    unsigned placeholder;
+    Stack<Clause*> clauses;
+    // predicates added when building the hypothesis (e.g. smallerThan)
+    unsigned firstSchemaPred;
+    unsigned schemaPreds;
+    // symbols added by the clausification, every instance gets fresh ones
+    Stack<unsigned> skolemFunctions;
+    Stack<unsigned> skolemPredicates;
+  };
+
   void process(Clause* premise, Literal* lit);
 
-  void produceClauses(Clause* premise, Literal* origLit, Formula* hypothesis, Literal* conclusion, InferenceRule rule, ResultSubstitutionSP& substitution);
+  void produceClauses(Clause* premise, Literal* origLit, Schema schema, Literal* lit, Term* term, InferenceRule rule, ResultSubstitutionSP& substitution);
+
+  SchemaTemplate* getTemplate(Schema schema, Term* term);
+  void instantiateTemplate(SchemaTemplate* templ, Literal* lit, Term* term, unsigned firstSchemaPred, FormulaUnit* fu, Stack<Clause*>& acc);
+
+  Formula* buildHypothesis(Schema schema, Literal* lit, Term* term, Literal*& conclusion);
+  Formula* mathInductionOneHypothesis(Literal* lit, Term* term, bool up, Literal*& conclusion);
+  Formula* structInductionOneHypothesis(Literal* lit, Term* term, Literal*& conclusion);
+  Formula* structInductionTwoHypothesis(Literal* lit, Term* term, Literal*& conclusion);
+  Formula* structInductionThreeHypothesis(Literal* lit, Term* term, Literal*& conclusion);
 
   void performMathInductionOne(Clause* premise, Literal* origLit, Literal* lit, Term* t, InferenceRule rule); 
   void performMathInductionTwo(Clause* premise, Literal* origLit, Literal* lit, Term* t, InferenceRule rule);
@@ -617,7 +617,8 @@ VirtualIterator<Solution> TheoryInstAndSimp::getSolutions(Stack<Literal*>& theor
 
   // Currently we just get the single solution from Z3
 
-  // We use a new SMT solver
+  // We keep a single SMT solver (and its z3 context) for all calls and only reset
+  // its assertions, so that the translation of shared terms is reused across calls
   // currently these are not needed outside of this function so we put them here
   static SAT2FO naming;
   static Z3Interfacing solver(*env.options,naming);
@@ -681,7 +682,12 @@ VirtualIterator<Solution> TheoryInstAndSimp::getSolutions(Stack<Literal*>& theor
   }
 
   // now we can call the solver
-  SATSolver::Status status = solver.solve(UINT_MAX);
+  SATSolver::Status status;
+  {
+    TimeCounter tc(TC_THEORY_INST_SIMP_SMT);
+    env.statistics->theoryInstSimpSmtCalls++;
+    status = solver.solve(UINT_MAX);
+  }
 
   if(status == SATSolver::UNSATISFIABLE){
 #if DPRINT
@@ -699,6 +699,9 @@ void IGAlgorithm::doImmediateReactivation()
 {
   CALL("IGAlgorithm::doImmediateReactivation");
 
+  TimeCounter tc(TC_INST_GEN_REACTIVATION);
+  env.statistics->instGenReactivatedClauses += _deactivated.size();
+
   static ClauseStack toActivate;
   toActivate.reset();
 
@@ -722,6 +725,9 @@ void IGAlgorithm::doPassiveReactivation()
 {
   CALL("IGAlgorithm::doPassiveReactivation");
 
+  TimeCounter tc(TC_INST_GEN_REACTIVATION);
+  env.statistics->instGenReactivatedClauses += _deactivated.size();
+
   static ClauseStack toActivate;
   toActivate.reset();
 
@@ -759,29 +765,28 @@ void IGAlgorithm::wipeIndexes()
 }
 
 
+/**
+ * Let all the current clauses be selected again with respect to the current model.
+ *
+ * The clauses are already simplified, in the SAT solver and in the variant index,
+ * so only the active ones need to be taken out of the selection index and
+ * moved back to passive.
+ */
 void IGAlgorithm::restartWithCurrentClauses()
 {
   CALL("IGAlgorithm::restartWithCurrentClauses");
 
-  static RCClauseStack allClauses;
-  allClauses.reset();
-
-  while(_active.isNonEmpty()) {
-    allClauses.pushWithoutInc(_active.popWithoutDec());
-  }
-  while(!_passive.isEmpty()) {
-    allClauses.pushWithoutInc(_passive.popSelected());
-  }
-  while(_unprocessed.isNonEmpty()) {
-    allClauses.pushWithoutInc(_unprocessed.popWithoutDec());
-  }
+  TimeCounter tc(TC_INST_GEN_RESTARTS);
+  env.statistics->instGenRestarts++;
 
-  wipeIndexes();
+  _deactivated.reset();
+  _deactivatedSet.reset();
 
-  while(allClauses.isNonEmpty()) {
-    Clause* cl = allClauses.popWithoutDec();
-    addClause(cl);
-    cl->decRefCnt();//corresponds to the removal from the active and passive container
+  while(_active.isNonEmpty()) {
+    Clause* cl = _active.popWithoutDec();
+    removeFromIndex(cl);
+    //the reference held by _active is now held by _passive
+    _passive.add(cl);
   }
 }
 
@@ -789,6 +794,9 @@ void IGAlgorithm::restartFromBeginning()
 {
   CALL("IGAlgorithm::restartFromBeginning");
 
+  TimeCounter tc(TC_INST_GEN_RESTARTS);
+  env.statistics->instGenRestartsFromBeginning++;
+
   /*
   {
     TimeCounter tc(TC_DISMATCHING);
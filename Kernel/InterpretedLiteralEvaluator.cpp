@@ -26,6 +26,7 @@
 #include "Theory.hpp"
 #include "NumTraits.hpp"
 #include "Debug/Tracer.hpp"
+#include "Shell/Statistics.hpp"
 
 
 #include "InterpretedLiteralEvaluator.hpp"
@@ -124,6 +125,11 @@ void stackTraverseIf(TermList term, Predicate pred, Fn action) {
  * x + ( y + ( t + 4 ) + r ) + 5  ==> ( ( (9 + x) + y ) + t ) + r
  * x + ( y + 0 )                  ==> x + y
  *
+ * For groups with an inverse function (i.e. the additive ones) a summand and its
+ * negation cancel each other out in the same pass, without building any intermediate term.
+ *
+ * x + ( y + -x ) + 1             ==> 1 + y
+ *
  * (The name of this class comes from the Associative Commutative operation of the Group)
  *
  * @author Giles (refactorings by joe-hauns)
@@ -150,6 +156,7 @@ CLASS_NAME(InterpretedLiteralEvaluator::ACFunEvaluator<AbelianGroup>);
     ASS_EQ(trm->arity(),2);
 
     unsigned nums = 0;
+    unsigned cancelled = 0;
     ConstantType acc = AbelianGroup::IDENTITY;
     Stack<TermList> keep;
     stackTraverseIf(TermList(trm), 
@@ -161,11 +168,13 @@ CLASS_NAME(InterpretedLiteralEvaluator::ACFunEvaluator<AbelianGroup>);
           if (t.isTerm() && theory->tryInterpretConstant(t.term(), c)) {
             acc = AbelianGroup::groundEval(acc, c);
             nums++;
+          } else if (cancel(keep, t)) {
+            cancelled++;
           } else {
             keep.push(t);
           }
         });
-    if (nums <= 1) return false;
+    if (nums <= 1 && cancelled == 0) return false;
 
     if (acc != AbelianGroup::IDENTITY) {
       keep.push(TermList(theory->representConstant(acc)));
@@ -185,6 +194,32 @@ CLASS_NAME(InterpretedLiteralEvaluator::ACFunEvaluator<AbelianGroup>);
       return TermList(trm) != res;
     }
   }
+
+private:
+  /** Return true iff @b t is -s for the inverse function of the group */
+  static bool isInverse(TermList t, TermList s) {
+    return AbelianGroup::inverse != Theory::INVALID_INTERPRETATION
+      && theory->isInterpretedFunction(t, AbelianGroup::inverse)
+      && *t.term()->nthArgument(0) == s;
+  }
+
+  /**
+   * If @b keep contains a summand which together with @b t gives the identity,
+   * remove it and return true.
+   */
+  static bool cancel(Stack<TermList>& keep, TermList t) {
+    for (unsigned i = 0; i < keep.size(); i++) {
+      if (isInverse(keep[i], t) || isInverse(t, keep[i])) {
+        // keep the order of the remaining summands
+        for (unsigned j = i + 1; j < keep.size(); j++) {
+          keep[j - 1] = keep[j];
+        }
+        keep.pop();
+        return true;
+      }
+    }
+    return false;
+  }
 };
 
 template<class Inequality>
@@ -995,9 +1030,11 @@ template<Theory::Interpretation op>
 struct AbelianGroup;
 
 /** Creates an instance of struct AbelianGroup<oper>, for the use in ACFunEvaluator. */
-#define IMPL_OPERATOR(oper, type, identity, eval) \
+#define IMPL_OPERATOR(oper, type, identity, eval, inv) \
   template<> struct AbelianGroup<oper> { \
     const static Theory::Interpretation interpreation = oper; \
+    /* the function giving the inverse element, or INVALID_INTERPRETATION */ \
+    const static Theory::Interpretation inverse = inv; \
     using ConstantType = type; \
     const static type IDENTITY; \
     static type groundEval(type l, type r) { return eval; } \
@@ -1006,16 +1043,16 @@ struct AbelianGroup;
   const type     AbelianGroup<oper>::IDENTITY = identity; \
 
 /* int opeators */
-IMPL_OPERATOR(Theory::INT_MULTIPLY, IntegerConstantType, IntegerConstantType(1), l * r)
-IMPL_OPERATOR(Theory::INT_PLUS, IntegerConstantType, IntegerConstantType(0), l + r)
+IMPL_OPERATOR(Theory::INT_MULTIPLY, IntegerConstantType, IntegerConstantType(1), l * r, Theory::INVALID_INTERPRETATION)
+IMPL_OPERATOR(Theory::INT_PLUS, IntegerConstantType, IntegerConstantType(0), l + r, Theory::INT_UNARY_MINUS)
 
 /* rational opeators */
-IMPL_OPERATOR(Theory::RAT_MULTIPLY, RationalConstantType, RationalConstantType(1), l * r)
-IMPL_OPERATOR(Theory::RAT_PLUS, RationalConstantType, RationalConstantType(0), l + r)
+IMPL_OPERATOR(Theory::RAT_MULTIPLY, RationalConstantType, RationalConstantType(1), l * r, Theory::INVALID_INTERPRETATION)
+IMPL_OPERATOR(Theory::RAT_PLUS, RationalConstantType, RationalConstantType(0), l + r, Theory::RAT_UNARY_MINUS)
 
 /* real opeators */
-IMPL_OPERATOR(Theory::REAL_MULTIPLY, RealConstantType, RealConstantType(RationalConstantType(1)), l * r)
-IMPL_OPERATOR(Theory::REAL_PLUS, RealConstantType, RealConstantType(RationalConstantType(0)), l + r)
+IMPL_OPERATOR(Theory::REAL_MULTIPLY, RealConstantType, RealConstantType(RationalConstantType(1)), l * r, Theory::INVALID_INTERPRETATION)
+IMPL_OPERATOR(Theory::REAL_PLUS, RealConstantType, RealConstantType(RationalConstantType(0)), l + r, Theory::REAL_UNARY_MINUS)
 
 ////////////////////////////////
 // InterpretedLiteralEvaluator
@@ -1578,6 +1615,32 @@ TermList InterpretedLiteralEvaluator::transformSubterm(TermList trm)
   return trm;
 }
 
+/**
+ * Return the already evaluated form of the shared subterm @b orig,
+ * so that TermTransformerTransformTransformed does not descend into it again.
+ */
+bool InterpretedLiteralEvaluator::lookupTransformed(Term* orig, TermList& res)
+{
+  CALL("InterpretedLiteralEvaluator::lookupTransformed");
+
+  if (_evalCache.find(orig, res)) {
+    env.statistics->evaluationCacheHits++;
+    return true;
+  }
+  env.statistics->evaluationCacheMisses++;
+  return false;
+}
+
+void InterpretedLiteralEvaluator::recordTransformed(Term* orig, TermList res)
+{
+  CALL("InterpretedLiteralEvaluator::recordTransformed");
+
+  if (_evalCache.size() >= EVAL_CACHE_LIMIT) {
+    _evalCache.reset();
+  }
+  _evalCache.insert(orig, res);
+}
+
 /**
  * This searches for an Evaluator for a function
  */
@@ -21,6 +21,7 @@
 #include "Forwards.hpp"
 
 #include "Lib/DArray.hpp"
+#include "Lib/DHMap.hpp"
 #include "Lib/Stack.hpp"
 
 #include "TermTransformer.hpp"
@@ -55,6 +56,8 @@ protected:
 
   typedef Stack<Evaluator*> EvalStack;
   virtual TermList transformSubterm(TermList trm);
+  virtual bool lookupTransformed(Term* orig, TermList& res);
+  virtual void recordTransformed(Term* orig, TermList res);
   Evaluator* getFuncEvaluator(unsigned func);
   Evaluator* getPredEvaluator(unsigned pred);
   EvalStack _evals;
@@ -90,6 +93,14 @@ private:
   template<class Fn>
   Evaluator* getEvaluator(unsigned func, DArray<Evaluator*>& evaluators, Fn canEval);
   const bool _normalize;
+
+  /**
+   * Evaluated forms of shared subterms. Since evaluation only depends on
+   * the (perfectly shared) term itself, an entry never becomes stale; the
+   * table is just emptied whenever it grows over EVAL_CACHE_LIMIT entries.
+   */
+  DHMap<Term*,TermList> _evalCache;
+  static const unsigned EVAL_CACHE_LIMIT = 1 << 16;
 };
 
 
@@ -259,7 +259,7 @@ unsigned Signature::addIntegerConstant(const vstring& number,bool defaultSort)
   vstring name = value.toString();
   vstring symbolKey = name + "_n";
   unsigned result;
-  if (_funNames.find(symbolKey,result)) {
+  if (_funKeys.find(symbolKey,result)) {
     return result;
   }
 
@@ -272,7 +272,7 @@ unsigned Signature::addIntegerConstant(const vstring& number,bool defaultSort)
   }
   */
   _funs.push(sym);
-  _funNames.insert(symbolKey,result);
+  _funKeys.insert(symbolKey,result);
   return result;
 } // Signature::addIntegerConstant
 
@@ -286,14 +286,14 @@ unsigned Signature::addIntegerConstant(const IntegerConstantType& value)
 
   vstring key = value.toString() + "_n";
   unsigned result;
-  if (_funNames.find(key, result)) {
+  if (_funKeys.find(key, result)) {
     return result;
   }
   _integers++;
   result = _funs.length();
   Symbol* sym = new IntegerSymbol(value);
   _funs.push(sym);
-  _funNames.insert(key,result);
+  _funKeys.insert(key,result);
   /*
   sym->addToDistinctGroup(INTEGER_DISTINCT_GROUP,result);
   */
@@ -318,7 +318,7 @@ unsigned Signature::addRationalConstant(const vstring& numerator, const vstring&
   vstring name = value.toString();
   vstring key = name + "_q";
   unsigned result;
-  if (_funNames.find(key,result)) {
+  if (_funKeys.find(key,result)) {
     return result;
   }
   result = _funs.length();
@@ -330,7 +330,7 @@ unsigned Signature::addRationalConstant(const vstring& numerator, const vstring&
   sym->addToDistinctGroup(RATIONAL_DISTINCT_GROUP,result);
   */
   _funs.push(sym);
-  _funNames.insert(key,result);
+  _funKeys.insert(key,result);
   return result;
 } // addRatonalConstant
 
@@ -340,13 +340,13 @@ unsigned Signature::addRationalConstant(const RationalConstantType& value)
 
   vstring key = value.toString() + "_q";
   unsigned result;
-  if (_funNames.find(key, result)) {
+  if (_funKeys.find(key, result)) {
     return result;
   }
   _rationals++;
   result = _funs.length();
   _funs.push(new RationalSymbol(value));
-  _funNames.insert(key, result);
+  _funKeys.insert(key, result);
   return result;
 } // Signature::addRationalConstant
 
@@ -366,7 +366,7 @@ unsigned Signature::addRealConstant(const vstring& number,bool defaultSort)
   }
   vstring key = value.toString() + "_r";
   unsigned result;
-  if (_funNames.find(key,result)) {
+  if (_funKeys.find(key,result)) {
     return result;
   }
   result = _funs.length();
@@ -378,7 +378,7 @@ unsigned Signature::addRealConstant(const vstring& number,bool defaultSort)
   sym->addToDistinctGroup(REAL_DISTINCT_GROUP,result);
   */
   _funs.push(sym);
-  _funNames.insert(key,result);
+  _funKeys.insert(key,result);
   return result;
 } // addRealConstant
 
@@ -388,13 +388,13 @@ unsigned Signature::addRealConstant(const RealConstantType& value)
 
   vstring key = value.toString() + "_r";
   unsigned result;
-  if (_funNames.find(key, result)) {
+  if (_funKeys.find(key, result)) {
     return result;
   }
   _reals++;
   result = _funs.length();
   _funs.push(new RealSymbol(value));
-  _funNames.insert(key, result);
+  _funKeys.insert(key, result);
   return result;
 }
 
@@ -417,12 +417,12 @@ unsigned Signature::addInterpretedFunction(Interpretation interpretation, Operat
   }
 
   vstring symbolKey = name+"_i"+Int::toString(interpretation)+(Theory::isPolymorphic(interpretation) ? type->toString() : "");
-  ASS(!_funNames.find(symbolKey));
+  ASS(!_funKeys.find(symbolKey));
 
   unsigned fnNum = _funs.length();
   InterpretedSymbol* sym = new InterpretedSymbol(name, interpretation);
   _funs.push(sym);
-  _funNames.insert(symbolKey, fnNum);
+  _funKeys.insert(symbolKey, fnNum);
   ALWAYS(_iSymbols.insert(mi, fnNum));
 
   OperatorType* fnType = type;
@@ -455,12 +455,12 @@ unsigned Signature::addInterpretedPredicate(Interpretation interpretation, Opera
 
   // cout << "symbolKey " << symbolKey << endl;
 
-  ASS(!_predNames.find(symbolKey));
+  ASS(!_predKeys.find(symbolKey));
 
   unsigned predNum = _preds.length();
   InterpretedSymbol* sym = new InterpretedSymbol(name, interpretation);
   _preds.push(sym);
-  _predNames.insert(symbolKey,predNum);
+  _predKeys.insert(symbolKey,predNum);
   ALWAYS(_iSymbols.insert(mi, predNum));
   if (predNum!=0) {
     OperatorType* predType = type;
@@ -541,7 +541,7 @@ bool Signature::functionExists(const vstring& name,unsigned arity) const
 {
   CALL("Signature::functionExists");
 
-  return _funNames.find(key(name, arity));
+  return _funNames.find(name, arity);
 }
 
 /**
@@ -551,21 +551,21 @@ bool Signature::predicateExists(const vstring& name,unsigned arity) const
 {
   CALL("Signature::predicateExists");
 
-  return _predNames.find(key(name, arity));
+  return _predNames.find(name, arity);
 }
 
 unsigned Signature::getFunctionNumber(const vstring& name, unsigned arity) const
 {
   CALL("Signature::getFunctionNumber");
 
-  ASS(_funNames.find(key(name, arity)));
-  return _funNames.get(key(name, arity));
+  ASS(_funNames.find(name, arity));
+  return _funNames.get(name, arity);
 }
 
 bool Signature::tryGetFunctionNumber(const vstring& name, unsigned arity, unsigned& out) const
 {
   CALL("Signature::tryGetFunctionNumber");
-  auto* value = _funNames.getPtr(key(name, arity));
+  auto* value = _funNames.getPtr(name, arity);
   if (value != NULL) {
     out = *value;
     return true;
@@ -577,7 +577,7 @@ bool Signature::tryGetFunctionNumber(const vstring& name, unsigned arity, unsign
 bool Signature::tryGetPredicateNumber(const vstring& name, unsigned arity, unsigned& out) const
 {
   CALL("Signature::tryGetPredicateNumber");
-  auto* value = _predNames.getPtr(key(name, arity));
+  auto* value = _predNames.getPtr(name, arity);
   if (value != NULL) {
     out = *value;
     return true;
@@ -591,8 +591,8 @@ unsigned Signature::getPredicateNumber(const vstring& name, unsigned arity) cons
 {
   CALL("Signature::getPredicateNumber");
 
-  ASS(_predNames.find(key(name, arity)));
-  return _predNames.get(key(name, arity));
+  ASS(_predNames.find(name, arity));
+  return _predNames.get(name, arity);
 }
 
 /**
@@ -612,9 +612,8 @@ unsigned Signature::addFunction (const vstring& name,
 {
   CALL("Signature::addFunction");
 
-  vstring symbolKey = key(name,arity);
   unsigned result;
-  if (_funNames.find(symbolKey,result)) {
+  if (_funNames.find(name,arity,result)) {
     added = false;
     getFunction(result)->unmarkIntroduced();
     return result;
@@ -634,7 +633,7 @@ unsigned Signature::addFunction (const vstring& name,
 
   result = _funs.length();
   _funs.push(new Symbol(name, arity, false, false, false, overflowConstant));
-  _funNames.insert(symbolKey, result);
+  _funNames.insert(name, arity, result);
   added = true;
   return result;
 } // Signature::addFunction
@@ -650,7 +649,7 @@ unsigned Signature::addStringConstant(const vstring& name)
 
   vstring symbolKey = name + "_c";
   unsigned result;
-  if (_funNames.find(symbolKey,result)) {
+  if (_funKeys.find(symbolKey,result)) {
     return result;
   }
 
@@ -660,7 +659,7 @@ unsigned Signature::addStringConstant(const vstring& name)
   Symbol* sym = new Symbol(quotedName,0,false,true);
   sym->addToDistinctGroup(STRING_DISTINCT_GROUP,result);
   _funs.push(sym);
-  _funNames.insert(symbolKey,result);
+  _funKeys.insert(symbolKey,result);
   return result;
 } // addStringConstant
 
@@ -683,9 +682,8 @@ unsigned Signature::addPredicate (const vstring& name,
 {
   CALL("Signature::addPredicate");
 
-  vstring symbolKey = key(name,arity);
   unsigned result;
-  if (_predNames.find(symbolKey,result)) {
+  if (_predNames.find(name,arity,result)) {
     added = false;
     getPredicate(result)->unmarkIntroduced();
     return result;
@@ -705,7 +703,7 @@ unsigned Signature::addPredicate (const vstring& name,
 
   result = _preds.length();
   _preds.push(new Symbol(name,arity));
-  _predNames.insert(symbolKey,result);
+  _predNames.insert(name,arity,result);
   added = true;
   return result;
 } // Signature::addPredicate
@@ -820,20 +818,6 @@ unsigned Signature::addSkolemPredicate(unsigned arity, const char* suffix)
   return f;
 } // addSkolemPredicate
 
-/**
- * Return the key "name_arity" used for hashing. This key is obtained by
- * concatenating the name, underscore character and the arity. The key is
- * created in such a way that it does not collide with special keys, such as
- * those for string constants.
- * @since 27/02/2006 Redmond
- * @author Andrei Voronkov
- */
-vstring Signature::key(const vstring& name,int arity)
-{
-  return name + '_' + Int::toString(arity);
-} // Signature::key
-
-
 /** Add a color to the symbol for interpolation and symbol elimination purposes */
 void Signature::Symbol::addColor(Color color)
 {
@@ -29,6 +29,7 @@
 #include "Lib/Stack.hpp"
 #include "Lib/Map.hpp"
 #include "Lib/DHMap.hpp"
+#include "Lib/NameArityMap.hpp"
 #include "Lib/VString.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/SmartPtr.hpp"
@@ -421,11 +422,9 @@ class Signature
   }
 
   /** return true iff predicate of given @b name and @b arity exists. */
-  bool isPredicateName(vstring name, unsigned arity)
+  bool isPredicateName(const vstring& name, unsigned arity)
   {
-    vstring symbolKey = key(name,arity);
-    unsigned tmp;
-    return _predNames.find(symbolKey,tmp);
+    return _predNames.find(name,arity);
   }
 
   /** return the number of functions */
@@ -477,7 +476,6 @@ class Signature
 
   bool hasTermAlgebras() { return !_termAlgebras.isEmpty(); }
       
-  static vstring key(const vstring& name,int arity);
 
   /** the number of string constants */
   unsigned strings() const {return _strings;}
@@ -531,15 +529,20 @@ private:
   Stack<Symbol*> _funs;
   /** Stack of predicate symbols */
   Stack<Symbol*> _preds;
+  /** Map from names and arities of uninterpreted functions to their numbers */
+  NameArityMap _funNames;
+  /** Map from names and arities of uninterpreted predicates to their numbers */
+  NameArityMap _predNames;
   /**
-   * Map from vstring "name_arity" to their numbers
+   * Map from keys of interpreted functions and of constants to their numbers
    *
    * String constants have key "value_c", integer constants "value_n",
-   * rational "numerator_denominator_q" and real "value_r".
+   * rational "numerator_denominator_q" and real "value_r". Interpreted
+   * functions have key "name_i" followed by the interpretation.
    */
-  SymbolMap _funNames;
-  /** Map from vstring "name_arity" to their numbers */
-  SymbolMap _predNames;
+  SymbolMap _funKeys;
+  /** Map from keys of interpreted predicates, "name_i" followed by the interpretation, to their numbers */
+  SymbolMap _predKeys;
   /** Map for the arity_check options: maps symbols to their arities */
   SymbolMap _arityCheck;
   /** Last number used for fresh functions and predicates */
@@ -271,7 +271,9 @@ Term* TermTransformerTransformTransformed::transform(Term* term)
 
       // cout << "args.length() - orig->arity() = " << args.length() - orig->arity() << endl;
 
-      args.push(transformSubterm(TermList(Term::create(orig,argLst))));
+      TermList res = transformSubterm(TermList(Term::create(orig,argLst)));
+      recordTransformed(orig, res);
+      args.push(res);
       continue;
     } else {
       toDo.push(tt->next());
@@ -287,6 +289,11 @@ Term* TermTransformerTransformTransformed::transform(Term* term)
     }
     ASS(tl.isTerm());
     Term* t=tl.term();
+    TermList known;
+    if(lookupTransformed(t, known)) {
+      args.push(known);
+      continue;
+    }
     terms.push(t);
     toDo.push(t->args());
   }
@@ -57,6 +57,14 @@ public:
   Literal* transform(Literal* lit);
 protected:
   virtual TermList transformSubterm(TermList trm) = 0;
+  /**
+   * If the transformed version of the shared (non-literal) subterm @b orig
+   * is already known, return true and assign it to @b res. The subterms of
+   * @b orig are then not traversed at all.
+   */
+  virtual bool lookupTransformed(Term* orig, TermList& res) { return false; }
+  /** Called with each transformed shared (non-literal) subterm */
+  virtual void recordTransformed(Term* orig, TermList res) {}
   /**
    * TODO: these functions are exactly the same as in TermTransformer, code duplication must be removed!
    */
@@ -354,14 +354,58 @@ void RationalConstantType::init(InnerType num, InnerType den)
   if(_den.toInner()==0) throw DivByZeroException();
 }
 
+/**
+ * Build the canonical rational num/den from 64-bit intermediate values.
+ *
+ * The products of two inner values always fit into 64 bits, so the
+ * arithmetic operations compute with them exactly and only reduce by the gcd
+ * afterwards. An exception is only thrown if the reduced fraction itself
+ * does not fit the inner type, not when just an intermediate result would.
+ */
+RationalConstantType RationalConstantType::fromWide(long long num, long long den)
+{
+  CALL("RationalConstantType::fromWide");
+
+  if (den==0) {
+    throw DivByZeroException();
+  }
+
+  unsigned long long a = num<0 ? -(unsigned long long)num : num;
+  unsigned long long b = den<0 ? -(unsigned long long)den : den;
+  while (b!=0) {
+    unsigned long long t = a % b;
+    a = b;
+    b = t;
+  }
+  // a is now the gcd, which is non-zero since den is
+  if (a!=1) {
+    num /= (long long)a;
+    den /= (long long)a;
+  }
+  if (den<0) {
+    num = -num;
+    den = -den;
+  }
+  if (num<numeric_limits<int>::min() || num>numeric_limits<int>::max() || den>numeric_limits<int>::max()) {
+    throw MachineArithmeticException();
+  }
+  return RationalConstantType(InnerType((int)num), InnerType((int)den));
+}
+
 RationalConstantType RationalConstantType::operator+(const RationalConstantType& o) const
 {
   CALL("RationalConstantType::operator+");
 
   if (_den==o._den) {
-    return RationalConstantType(_num + o._num, _den);
+    return fromWide((long long)_num.toInner() + o._num.toInner(), _den.toInner());
+  }
+  long long lhs = (long long)_num.toInner() * o._den.toInner();
+  long long rhs = (long long)o._num.toInner() * _den.toInner();
+  long long sum;
+  if (!Int::safePlus(lhs, rhs, sum)) {
+    throw MachineArithmeticException();
   }
-  return RationalConstantType(_num*o._den + o._num*_den, _den*o._den);
+  return fromWide(sum, (long long)_den.toInner() * o._den.toInner());
 }
 
 RationalConstantType RationalConstantType::operator-(const RationalConstantType& o) const
@@ -375,24 +419,23 @@ RationalConstantType RationalConstantType::operator-() const
 {
   CALL("RationalConstantType::operator-/0");
 
-  return RationalConstantType(-_num, _den);
+  return fromWide(-(long long)_num.toInner(), _den.toInner());
 }
 
 RationalConstantType RationalConstantType::operator*(const RationalConstantType& o) const
 {
   CALL("RationalConstantType::operator*");
 
-  return RationalConstantType(_num*o._num, _den*o._den);
+  return fromWide((long long)_num.toInner() * o._num.toInner(),
+                  (long long)_den.toInner() * o._den.toInner());
 }
 
 RationalConstantType RationalConstantType::operator/(const RationalConstantType& o) const
 {
   CALL("RationalConstantType::operator/");
-  auto lhs = *this;
-  auto rhs = o;
-  return RationalConstantType(
-      lhs._num * rhs._den, 
-      lhs._den * rhs._num);
+
+  return fromWide((long long)_num.toInner() * o._den.toInner(),
+                  (long long)_den.toInner() * o._num.toInner());
 }
 
 bool RationalConstantType::isInt() const
@@ -413,7 +456,8 @@ bool RationalConstantType::operator>(const RationalConstantType& o) const
 {
   CALL("IntegerConstantType::operator>");
 
-  return (_num*o._den)>(o._num*_den);
+  // the denominators are positive and the products cannot overflow 64 bits
+  return (long long)_num.toInner() * o._den.toInner() > (long long)o._num.toInner() * _den.toInner();
 }
 
 
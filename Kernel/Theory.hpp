@@ -168,6 +168,7 @@ protected:
 
 private:
   void cannonize();
+  static RationalConstantType fromWide(long long num, long long den);
 
   InnerType _num;
   InnerType _den;
@@ -24,6 +24,7 @@
 
 #endif
 
+#include <algorithm>
 #include <cstring>
 #include <cstdlib>
 #include "Lib/System.hpp"
@@ -96,6 +97,15 @@ Allocator* Allocator::current;
 Allocator::Page* Allocator::_pages[MAX_PAGES];
 size_t Allocator::_usedMemory = 0;
 Allocator* Allocator::_all[MAX_ALLOCATORS];
+bool Allocator::_telemetry = false;
+Allocator::ClassUsage* Allocator::_classUsage = 0;
+Allocator::ClassUsage Allocator::_otherClasses;
+size_t Allocator::_classUsageCount = 0;
+long long Allocator::_liveBytes = 0;
+long long Allocator::_peakLiveBytes = 0;
+
+/** Capacity of the table of per-class counters, must be a power of two */
+#define CLASS_USAGE_CAPACITY 8192
 
 #if VDEBUG
 unsigned Allocator::Descriptor::globalTimestamp;
@@ -269,6 +279,195 @@ void Allocator::reportUsageByClasses()
 
 #endif
 
+/**
+ * Start counting allocations per class, see reportTelemetry().
+ */
+void Allocator::enableTelemetry()
+{
+  CALLC("Allocator::enableTelemetry",MAKE_CALLS);
+
+  if (_telemetry) {
+    return;
+  }
+  // the table is not allocated by us, so that it does not count in
+  // the used memory and cannot recurse into the telemetry
+  _classUsage = static_cast<ClassUsage*>(calloc(CLASS_USAGE_CAPACITY, sizeof(ClassUsage)));
+  if (!_classUsage) {
+    return;
+  }
+  _otherClasses.cls = "(other classes)";
+  _telemetry = true;
+} // Allocator::enableTelemetry
+
+/**
+ * Return the counters of the class named @b className. Classes are
+ * distinguished by the address of the name, classes that do not fit
+ * into the table share one entry.
+ */
+Allocator::ClassUsage& Allocator::classUsage(const char* className)
+{
+  size_t idx = (reinterpret_cast<size_t>(className)>>3)*2654435761u;
+  for (;;) {
+    idx &= CLASS_USAGE_CAPACITY-1;
+    ClassUsage& cu = _classUsage[idx];
+    if (cu.cls == className) {
+      return cu;
+    }
+    if (!cu.cls) {
+      // keep the table at most half full so that lookups stay short
+      if (_classUsageCount >= CLASS_USAGE_CAPACITY/2) {
+        return _otherClasses;
+      }
+      _classUsageCount++;
+      cu.cls = className;
+      return cu;
+    }
+    idx++;
+  }
+}
+
+void Allocator::recordAllocation(const char* className, size_t size)
+{
+  ClassUsage& cu = classUsage(className);
+  cu.allocations++;
+  cu.liveBytes += size;
+  if (cu.liveBytes > cu.peakBytes) {
+    cu.peakBytes = cu.liveBytes;
+  }
+  _liveBytes += size;
+  if (_liveBytes > _peakLiveBytes) {
+    _peakLiveBytes = _liveBytes;
+  }
+}
+
+void Allocator::recordDeallocation(const char* className, size_t size)
+{
+  ClassUsage& cu = classUsage(className);
+  cu.deallocations++;
+  cu.liveBytes -= size;
+  _liveBytes -= size;
+}
+
+/**
+ * Print the allocator telemetry: live and peak bytes and the numbers of
+ * (de)allocations per class, together with the memory the allocator
+ * holds without it being used by any object, that is, pieces in the free
+ * lists, the rest of the reserve pages and pages returned to the global
+ * page manager.
+ *
+ * Nothing is allocated by the Allocator here, so that the report can
+ * be printed also when the memory limit has been reached.
+ */
+void Allocator::reportTelemetry(ostream& out)
+{
+  CALLC("Allocator::reportTelemetry",MAKE_CALLS);
+
+  if (!_telemetry) {
+    return;
+  }
+
+  addCommentSignForSZS(out);
+  out << "Allocator telemetry" << endl;
+  addCommentSignForSZS(out);
+  out << "Memory held by pages: " << _usedMemory << " bytes, live: " << _liveBytes
+      << " bytes, peak live: " << _peakLiveBytes << " bytes" << endl;
+
+#if ! USE_SYSTEM_ALLOCATION
+  size_t freePageCnt = 0;
+  size_t freePageBytes = 0;
+  for (int i = MAX_PAGES-1;i >= 0;i--) {
+    for (Page* pg = _pages[i]; pg; pg = pg->next) {
+      freePageCnt++;
+      freePageBytes += pg->size;
+    }
+  }
+  size_t reserveBytes = 0;
+  size_t freePieceCnt = 0;
+  size_t freePieceBytes = 0;
+  // the free list size class holding the most bytes
+  size_t worstSize = 0;
+  size_t worstBytes = 0;
+  for (int a = 0;a < _total;a++) {
+    Allocator* alloc = _all[a];
+    reserveBytes += alloc->_reserveBytesAvailable;
+    for (int i = REQUIRES_PAGE/4-1;i >= 0;i--) {
+      size_t pieceSize = (i+1)*sizeof(Known);
+      size_t cnt = 0;
+      for (Known* k = alloc->_freeList[i]; k; k = k->next) {
+        cnt++;
+      }
+      freePieceCnt += cnt;
+      freePieceBytes += cnt*pieceSize;
+      if (cnt*pieceSize > worstBytes) {
+        worstBytes = cnt*pieceSize;
+        worstSize = pieceSize;
+      }
+    }
+  }
+  size_t pageBytesInUse = _usedMemory-freePageBytes;
+
+  addCommentSignForSZS(out);
+  out << "Unused page capacity: " << freePageCnt << " free pages (" << freePageBytes
+      << " bytes), " << reserveBytes << " bytes of reserve pages" << endl;
+  addCommentSignForSZS(out);
+  out << "Free lists: " << freePieceCnt << " pieces (" << freePieceBytes << " bytes";
+  if (pageBytesInUse) {
+    out << ", " << (100*freePieceBytes/pageBytesInUse) << "% of pages in use";
+  }
+  out << ")";
+  if (worstBytes) {
+    out << ", most of it in pieces of " << worstSize << " bytes (" << worstBytes << " bytes)";
+  }
+  out << endl;
+#endif // ! USE_SYSTEM_ALLOCATION
+
+  // copy the used entries aside, merging classes whose names are equal
+  // strings at different addresses
+  size_t cnt = 0;
+  ClassUsage* usages = static_cast<ClassUsage*>(malloc((_classUsageCount+1)*sizeof(ClassUsage)));
+  if (!usages) {
+    return;
+  }
+  for (size_t i = 0;i < CLASS_USAGE_CAPACITY;i++) {
+    if (_classUsage[i].cls) {
+      usages[cnt++] = _classUsage[i];
+    }
+  }
+  if (_otherClasses.allocations || _otherClasses.deallocations) {
+    usages[cnt++] = _otherClasses;
+  }
+  std::sort(usages, usages+cnt, [](const ClassUsage& u1, const ClassUsage& u2) {
+    return strcmp(u1.cls, u2.cls) < 0;
+  });
+  size_t merged = 0;
+  for (size_t i = 0;i < cnt;i++) {
+    if (merged && !strcmp(usages[merged-1].cls, usages[i].cls)) {
+      ClassUsage& cu = usages[merged-1];
+      cu.liveBytes += usages[i].liveBytes;
+      // not exact, the peaks may have been reached at different times
+      cu.peakBytes += usages[i].peakBytes;
+      cu.allocations += usages[i].allocations;
+      cu.deallocations += usages[i].deallocations;
+    }
+    else {
+      usages[merged++] = usages[i];
+    }
+  }
+  std::sort(usages, usages+merged, [](const ClassUsage& u1, const ClassUsage& u2) {
+    return u1.peakBytes > u2.peakBytes;
+  });
+
+  addCommentSignForSZS(out);
+  out << "class\tlive bytes\tpeak bytes\tallocations\tdeallocations" << endl;
+  for (size_t i = 0;i < merged;i++) {
+    ClassUsage& cu = usages[i];
+    addCommentSignForSZS(out);
+    out << cu.cls << "\t" << cu.liveBytes << "\t" << cu.peakBytes << "\t"
+        << cu.allocations << "\t" << cu.deallocations << endl;
+  }
+  free(usages);
+} // Allocator::reportTelemetry
+
 /**
  * Cleanup: do whatever needed after the last use of class Allocator.
  * @since 10/01/2008 Manchester
@@ -327,6 +526,11 @@ void Allocator::cleanup()
 #if VDEBUG
   delete[] Descriptor::map;
 #endif  
+
+  if (_telemetry) {
+    _telemetry = false;
+    free(_classUsage);
+  }
 } // Allocator::initialise
 
 
@@ -337,11 +541,7 @@ void Allocator::cleanup()
  * object.
  * @since 10/01/2008 Manchester
  */
-#if VDEBUG
 void Allocator::deallocateKnown(void* obj,size_t size,const char* className)
-#else
-void Allocator::deallocateKnown(void* obj,size_t size)
-#endif
 {
   CALLC("Allocator::deallocateKnown",MAKE_CALLS);
   ASS(obj);
@@ -360,6 +560,10 @@ void Allocator::deallocateKnown(void* obj,size_t size)
   ASS(! desc->page);
 #endif
 
+  if (_telemetry) {
+    recordDeallocation(className,size);
+  }
+
 #if USE_SYSTEM_ALLOCATION
 #if VDEBUG
   desc->allocated = 0;
@@ -411,11 +615,7 @@ void Allocator::deallocateKnown(void* obj,size_t size)
  * storing the size of the object.
  * @since 13/01/2008 Manchester
  */
-#if VDEBUG
 void Allocator::deallocateUnknown(void* obj,const char* className)
-#else
-void Allocator::deallocateUnknown(void* obj)
-#endif
 {
   CALLC("Allocator::deallocateUnknown",MAKE_CALLS);
 
@@ -433,6 +633,10 @@ void Allocator::deallocateUnknown(void* obj)
   desc->allocated = 0;
 #endif
 
+  if (_telemetry) {
+    recordDeallocation(className,unknownsSize(obj)+sizeof(Known));
+  }
+
 #if USE_SYSTEM_ALLOCATION
   char* memObj = reinterpret_cast<char*>(obj) - sizeof(Known);
   free(memObj);
@@ -487,21 +691,13 @@ void Allocator::deallocateUnknown(void* obj)
  *
  * The corresponding "free" function is deallocateUnknown.
  */
-#if VDEBUG
 void* Allocator::reallocateUnknown(void* obj, size_t newsize, const char* className)
-#else
-void* Allocator::reallocateUnknown(void* obj, size_t newsize)
-#endif
 {
   CALLC("Allocator::reallocateUnknown",MAKE_CALLS);
 
   // cout << "reallocateUnknown " << obj << " newsize " << newsize << endl;
 
-#if VDEBUG
   void* newobj = allocateUnknown(newsize,className);
-#else
-  void* newobj = allocateUnknown(newsize);
-#endif
 
   if (obj == NULL) {
     return newobj;
@@ -517,11 +713,7 @@ void* Allocator::reallocateUnknown(void* obj, size_t newsize)
 
   std::memcpy(newobj,obj,size);
 
-#if VDEBUG
   deallocateUnknown(obj,className);
-#else
-  deallocateUnknown(obj);
-#endif
 
   return newobj;
 } // Allocator::reallocateUnknown
@@ -757,16 +949,15 @@ void Allocator::deallocatePages(Page* page)
  * Allocate object of size @b size. 
  * @since 12/01/2008 Manchester
  */
-#if VDEBUG
 void* Allocator::allocateKnown(size_t size,const char* className)
-#else
-void* Allocator::allocateKnown(size_t size)
-#endif
 {
   CALLC("Allocator::allocateKnown",MAKE_CALLS);
   ASS(size > 0);
 
   char* result = allocatePiece(size);
+  if (_telemetry) {
+    recordAllocation(className,size);
+  }
 
 #if VDEBUG
   Descriptor* desc = Descriptor::find(result);
@@ -878,11 +1069,7 @@ char* Allocator::allocatePiece(size_t size)
  * of the object plus the size of a word.
  * @since 13/01/2008 Manchester
  */
-#if VDEBUG
 void* Allocator::allocateUnknown(size_t size,const char* className)
-#else
-void* Allocator::allocateUnknown(size_t size)
-#endif
 {
   CALLC("Allocator::allocateUnknown",MAKE_CALLS);
   ASS(size>0);
@@ -892,6 +1079,9 @@ void* Allocator::allocateUnknown(size_t size)
   Unknown* unknown = reinterpret_cast<Unknown*>(result);
   unknown->size = size;
   result += sizeof(Known);
+  if (_telemetry) {
+    recordAllocation(className,size);
+  }
 
 #if VDEBUG
   Descriptor* desc = Descriptor::find(result);
@@ -23,6 +23,7 @@
 #define __Allocator__
 
 #include <cstddef>
+#include <iosfwd>
 
 #include "Debug/Assertion.hpp"
 #include "Debug/Tracer.hpp"
@@ -95,22 +96,23 @@ public:
    * - through which allocations by the here defined macros are channelled */
   static Allocator* current;
 
-#if VDEBUG
   void* allocateKnown(size_t size,const char* className) ALLOC_SIZE_ATTR;
   void deallocateKnown(void* obj,size_t size,const char* className);
   void* allocateUnknown(size_t size,const char* className) ALLOC_SIZE_ATTR;
   void* reallocateUnknown(void* obj, size_t newsize,const char* className);
   void deallocateUnknown(void* obj,const char* className);
+#if VDEBUG
   static void addressStatus(const void* address);
   static void reportUsageByClasses();
-#else
-  void* allocateKnown(size_t size) ALLOC_SIZE_ATTR;
-  void deallocateKnown(void* obj,size_t size);
-  void* allocateUnknown(size_t size) ALLOC_SIZE_ATTR;
-  void* reallocateUnknown(void* obj, size_t newsize);
-  void deallocateUnknown(void* obj);
 #endif
 
+  static void enableTelemetry();
+  /** True if allocations are being counted per class */
+  static bool telemetryEnabled() { return _telemetry; }
+  /** Bytes allocated and not yet deallocated since the telemetry was enabled, 0 without it */
+  static long long liveBytes() { return _liveBytes; }
+  static void reportTelemetry(std::ostream& out);
+
   class Initialiser {
   public:
     /** Initialise the static allocator's methods */
@@ -183,6 +185,37 @@ private:
     Unknown* next;
   }; // class Unknown
 
+  /**
+   * Allocation counters of one class, kept when the telemetry is enabled.
+   * The counting starts when the telemetry is enabled, so the live bytes
+   * of a class with objects allocated before that can be negative.
+   */
+  struct ClassUsage {
+    /** class name, 0 for an unused entry */
+    const char* cls;
+    long long liveBytes;
+    long long peakBytes;
+    unsigned long long allocations;
+    unsigned long long deallocations;
+  };
+
+  static ClassUsage& classUsage(const char* className);
+  static void recordAllocation(const char* className, size_t size);
+  static void recordDeallocation(const char* className, size_t size);
+
+  /** true if allocations are counted per class */
+  static bool _telemetry;
+  /** open addressing table of ClassUsage indexed by the address of the class name */
+  static ClassUsage* _classUsage;
+  /** counters for classes that did not fit into _classUsage */
+  static ClassUsage _otherClasses;
+  /** number of used entries of _classUsage */
+  static size_t _classUsageCount;
+  /** bytes allocated and not yet deallocated since the telemetry was enabled */
+  static long long _liveBytes;
+  /** maximal value of _liveBytes */
+  static long long _peakLiveBytes;
+
   static size_t unknownsSize(void* obj) {
     ASS_LE(sizeof(size_t), sizeof(Known)); // because the code all around jumps back by sizeof(Known), but then reads/writes into size_t
 
@@ -440,32 +473,35 @@ std::ostream& operator<<(std::ostream& out, const Allocator::Descriptor& d);
 
 #else
 
-#define CLASS_NAME(name)
+// class names are passed to the allocator also in release, so that
+// the allocator telemetry can report memory usage per class
+#define CLASS_NAME(C) \
+  static const char* className () { return #C; }
 #define ALLOC_KNOWN(size,className)				\
-  (Lib::Allocator::current->allocateKnown(size))
+  (Lib::Allocator::current->allocateKnown(size,className))
 #define DEALLOC_KNOWN(obj,size,className)		        \
-  (Lib::Allocator::current->deallocateKnown(obj,size))
+  (Lib::Allocator::current->deallocateKnown(obj,size,className))
 #define USE_ALLOCATOR_UNK                                            \
   inline void* operator new (size_t sz)                                       \
-  { return Lib::Allocator::current->allocateUnknown(sz); } \
+  { return Lib::Allocator::current->allocateUnknown(sz,className()); } \
   inline void operator delete (void* obj)                                  \
-  { if (obj) Lib::Allocator::current->deallocateUnknown(obj); }
+  { if (obj) Lib::Allocator::current->deallocateUnknown(obj,className()); }
 #define USE_ALLOCATOR(C)                                        \
   inline void* operator new (size_t)                                   \
-    { return Lib::Allocator::current->allocateKnown(sizeof(C)); }\
+    { return Lib::Allocator::current->allocateKnown(sizeof(C),className()); }\
   inline void operator delete (void* obj)                               \
-   { if (obj) Lib::Allocator::current->deallocateKnown(obj,sizeof(C)); }
+   { if (obj) Lib::Allocator::current->deallocateKnown(obj,sizeof(C),className()); }
 #define USE_ALLOCATOR_ARRAY                                            \
   inline void* operator new[] (size_t sz)                                       \
-  { return Lib::Allocator::current->allocateUnknown(sz); } \
+  { return Lib::Allocator::current->allocateUnknown(sz,className()); } \
   inline void operator delete[] (void* obj)                                  \
-  { if (obj) Lib::Allocator::current->deallocateUnknown(obj); }          
+  { if (obj) Lib::Allocator::current->deallocateUnknown(obj,className()); }          
 #define ALLOC_UNKNOWN(size,className)				\
-  (Lib::Allocator::current->allocateUnknown(size))
+  (Lib::Allocator::current->allocateUnknown(size,className))
 #define REALLOC_UNKNOWN(obj,newsize,className)                    \
-    (Lib::Allocator::current->reallocateUnknown(obj,newsize))
+    (Lib::Allocator::current->reallocateUnknown(obj,newsize,className))
 #define DEALLOC_UNKNOWN(obj,className)		         \
-  (Lib::Allocator::current->deallocateUnknown(obj))
+  (Lib::Allocator::current->deallocateUnknown(obj,className))
 
 #define START_CHECKING_FOR_ALLOCATOR_BYPASSES
 #define STOP_CHECKING_FOR_ALLOCATOR_BYPASSES
@@ -29,6 +29,7 @@
 #include "Shell/Options.hpp"
 #include "Shell/Statistics.hpp"
 
+#include "ReplayLog.hpp"
 #include "Timer.hpp"
 
 #include "Environment.hpp"
@@ -103,10 +104,19 @@ bool Environment::timeLimitReached() const
 {
   CALL("Environment::timeLimitReached");
 
-  if (options->timeLimitInDeciseconds() &&
-      timer->elapsedDeciseconds() > options->timeLimitInDeciseconds()) {
+  bool reached;
+  if (ReplayLog::replayingTimeLimit()) {
+    // the replayed run stops where the recorded one did, however long it takes
+    reached = ReplayLog::timeLimitReached();
+  } else {
+    // the first SIGALRM may come before the constructor has stored the timer
+    reached = options->timeLimitInDeciseconds() && timer &&
+        timer->elapsedDeciseconds() > options->timeLimitInDeciseconds();
+  }
+  if (reached) {
     statistics->terminationReason = Shell::Statistics::TIME_LIMIT;
     Timer::setTimeLimitEnforcement(false);
+    ReplayLog::onTimeLimitReached();
     return true;
   }
   return false;
@@ -0,0 +1,129 @@
+/*
+ * File NameArityMap.hpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file NameArityMap.hpp
+ * Defines class NameArityMap of maps from symbol names and arities.
+ */
+
+#ifndef __NameArityMap__
+#define __NameArityMap__
+
+#include <cstring>
+
+#include "Debug/Assertion.hpp"
+
+#include "Allocator.hpp"
+#include "Hash.hpp"
+#include "Map.hpp"
+#include "VString.hpp"
+
+namespace Lib {
+
+/**
+ * Map from pairs of a symbol name and an arity to unsigned values,
+ * used by Signature to find symbols by their names.
+ *
+ * A key refers to its name by a pointer and a length, so that looking
+ * a pair up neither builds a key string nor copies the name. The name is
+ * copied into the map once, when the pair is inserted. The map keeps the
+ * hash codes of the stored pairs, so names are not hashed again when
+ * it expands.
+ */
+class NameArityMap
+{
+public:
+  CLASS_NAME(NameArityMap);
+  USE_ALLOCATOR(NameArityMap);
+
+  NameArityMap() {}
+
+  ~NameArityMap()
+  {
+    CALL("NameArityMap::~NameArityMap");
+
+    NameMap::Iterator it(_map);
+    while (it.hasNext()) {
+      Key key;
+      unsigned val;
+      it.next(key, val);
+      DEALLOC_KNOWN(const_cast<char*>(key.name), key.length+1, "NameArityMap");
+    }
+  }
+
+  bool find(const vstring& name, unsigned arity) const
+  { return _map.find(Key(name, arity)); }
+
+  bool find(const vstring& name, unsigned arity, unsigned& val) const
+  { return _map.find(Key(name, arity), val); }
+
+  /** Return a pointer to the value of the pair, or nullptr if it is not in the map */
+  const unsigned* getPtr(const vstring& name, unsigned arity) const
+  { return _map.getPtr(Key(name, arity)); }
+
+  /** Return the value of the pair, which must be in the map */
+  unsigned get(const vstring& name, unsigned arity) const
+  { return _map.get(Key(name, arity)); }
+
+  /** Map the pair to @b val, the pair must not be in the map yet */
+  void insert(const vstring& name, unsigned arity, unsigned val)
+  {
+    CALL("NameArityMap::insert");
+    ASS(!find(name, arity));
+
+    size_t length = name.size();
+    char* copy = static_cast<char*>(ALLOC_KNOWN(length+1, "NameArityMap"));
+    memcpy(copy, name.c_str(), length+1);
+    _map.insert(Key(copy, length, arity), val);
+  }
+
+private:
+  NameArityMap(const NameArityMap&);
+  NameArityMap& operator=(const NameArityMap&);
+
+  struct Key
+  {
+    Key() : name(0), length(0), arity(0) {}
+    Key(const char* name, size_t length, unsigned arity)
+      : name(name), length(length), arity(arity) {}
+    Key(const vstring& name, unsigned arity)
+      : name(name.c_str()), length(name.size()), arity(arity) {}
+
+    const char* name;
+    size_t length;
+    unsigned arity;
+  };
+
+  struct KeyHash
+  {
+    static unsigned hash(const Key& key)
+    {
+      unsigned res = Hash::hash(key.arity);
+      if (key.length) {
+        res = Hash::hash(reinterpret_cast<const unsigned char*>(key.name), key.length, res);
+      }
+      return res;
+    }
+
+    static bool equals(const Key& key1, const Key& key2)
+    {
+      return key1.arity == key2.arity && key1.length == key2.length &&
+          !memcmp(key1.name, key2.name, key1.length);
+    }
+  };
+
+  typedef Map<Key,unsigned,KeyHash> NameMap;
+  NameMap _map;
+};
+
+}
+
+#endif // __NameArityMap__
@@ -74,6 +74,14 @@ public:
   {
     return _map.find(obj);
   }
+  /**
+   * If @b obj was already assigned a number, put it into @b res
+   * and return true. Unlike get(), never assigns a new number.
+   */
+  bool find(T obj, unsigned& res) const
+  {
+    return _map.find(obj, res);
+  }
   /** All numbers assigned by this object are less than or equal
    * to the result of this function */
   unsigned getNumberUpperBound() const
@@ -0,0 +1,332 @@
+/*
+ * File ReplayLog.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ReplayLog.cpp
+ * Implements class ReplayLog.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Debug/Tracer.hpp"
+
+#include "Environment.hpp"
+#include "Int.hpp"
+#include "System.hpp"
+
+#include "Shell/Statistics.hpp"
+
+#include "ReplayLog.hpp"
+
+namespace Lib {
+
+using namespace std;
+using namespace Shell;
+
+bool ReplayLog::s_recording = false;
+bool ReplayLog::s_replaying = false;
+bool ReplayLog::s_diverged = false;
+vstring ReplayLog::s_fileName;
+vstring ReplayLog::s_commandLine;
+int ReplayLog::s_recordingPid = 0;
+int ReplayLog::s_filePid = 0;
+int ReplayLog::s_fd = -1;
+Stack<ReplayLog::Entry> ReplayLog::s_entries;
+unsigned ReplayLog::s_nextEntry = 0;
+long long ReplayLog::s_timeLimitActivations = -1;
+long long ReplayLog::s_timeLimitGenerated = 0;
+
+namespace {
+
+/**
+ * Append @b kind and the numbers @b n1 and @b n2 as a line of the log
+ * to @b buf and return the end of the line. Does not allocate, so that
+ * it can be used in a signal handler.
+ */
+char* formatEntry(char* buf, const char* kind, long long n1, long long n2)
+{
+  char* p = buf;
+  while (*kind) {
+    *p++ = *kind++;
+  }
+  long long nums[2] = { n1, n2 };
+  for (long long n : nums) {
+    *p++ = ' ';
+    if (n < 0) {
+      *p++ = '-';
+      n = -n;
+    }
+    char digits[24];
+    int cnt = 0;
+    do {
+      digits[cnt++] = '0'+n%10;
+      n /= 10;
+    } while (n);
+    while (cnt) {
+      *p++ = digits[--cnt];
+    }
+  }
+  *p++ = '\n';
+  return p;
+}
+
+void writeAll(int fd, const char* buf, size_t len)
+{
+  while (len) {
+    ssize_t res = ::write(fd, buf, len);
+    if (res <= 0) {
+      return;
+    }
+    buf += res;
+    len -= res;
+  }
+}
+
+}
+
+/**
+ * Record the decisions of this run into @b fileName. The file is only
+ * created when the first decision is made, so that the processes forked
+ * by the portfolio modes record each into its own file, whose name is
+ * @b fileName followed by the process id.
+ *
+ * The command line @b argv is written into the header of the log, so
+ * that it tells how the run is replayed.
+ */
+void ReplayLog::startRecording(const char* fileName, int argc, char* argv[])
+{
+  CALL("ReplayLog::startRecording");
+  ASS(!s_replaying);
+
+  s_fileName = fileName;
+  s_commandLine = "";
+  for (int i=0; i<argc; i++) {
+    if (!strcmp(argv[i], "--record_replay") && i+1<argc) {
+      i++;
+      continue;
+    }
+    if (i) {
+      s_commandLine += " ";
+    }
+    s_commandLine += argv[i];
+  }
+  s_recordingPid = getpid();
+  s_recording = true;
+  System::addTerminationHandler(closeRecording);
+}
+
+/**
+ * Read the decisions recorded in @b fileName, they will be used instead
+ * of the decisions of this run.
+ */
+void ReplayLog::startReplay(const char* fileName)
+{
+  CALL("ReplayLog::startReplay");
+  ASS(!s_recording);
+
+  FILE* f = fopen(fileName, "r");
+  if (!f) {
+    USER_ERROR("Cannot open replay log "+vstring(fileName));
+  }
+  char line[256];
+  unsigned lineNum = 0;
+  while (fgets(line, sizeof(line), f)) {
+    lineNum++;
+    if (line[0]=='#' || line[0]=='\n') {
+      continue;
+    }
+    char kind[64];
+    Entry e;
+    if (sscanf(line, "%63s %lld %lld", kind, &e.activations, &e.value) != 3) {
+      fclose(f);
+      USER_ERROR("Invalid entry on line "+Int::toString(lineNum)+" of replay log "+vstring(fileName));
+    }
+    if (!strcmp(kind, "time_limit")) {
+      s_timeLimitActivations = e.activations;
+      s_timeLimitGenerated = e.value;
+      continue;
+    }
+    e.kind = kind;
+    s_entries.push(e);
+  }
+  fclose(f);
+  s_replaying = true;
+}
+
+/**
+ * Return the value of the decision @b kind. When recording, it is
+ * @b value, which is also written into the log. When replaying, it is
+ * the recorded value, unless the run has already diverged from the log.
+ */
+long long ReplayLog::decision(const char* kind, long long value)
+{
+  CALL("ReplayLog::decision");
+
+  if (s_recording) {
+    write(kind, value);
+  }
+  else if (s_replaying) {
+    Entry e;
+    if (nextEntry(kind, e)) {
+      return e.value;
+    }
+  }
+  return value;
+}
+
+/**
+ * Record @b value as a checkpoint @b kind of the run. When replaying,
+ * report a divergence if it differs from the recorded value.
+ */
+void ReplayLog::checkpoint(const char* kind, long long value)
+{
+  CALL("ReplayLog::checkpoint");
+
+  if (s_recording) {
+    write(kind, value);
+  }
+  else if (s_replaying) {
+    Entry e;
+    if (nextEntry(kind, e) && e.value != value) {
+      diverged(kind, "a different value");
+    }
+  }
+}
+
+/**
+ * When replaying, return true if the run has made as many activations
+ * and generated as many clauses as the recorded run before reaching
+ * the time limit. Used instead of measuring the time.
+ */
+bool ReplayLog::timeLimitReached()
+{
+  ASS(replayingTimeLimit());
+
+  long long activations = env.statistics->activeClauses;
+  return activations > s_timeLimitActivations ||
+      (activations == s_timeLimitActivations && env.statistics->generatedClauses >= s_timeLimitGenerated);
+}
+
+/**
+ * Record that the run reached the time limit. May be called from the
+ * SIGALRM handler while the main flow writes into the log, so we only
+ * note the counts here and closeRecording() writes the entry.
+ */
+void ReplayLog::onTimeLimitReached()
+{
+  if (s_recording && s_timeLimitActivations < 0) {
+    s_timeLimitGenerated = env.statistics->generatedClauses;
+    s_timeLimitActivations = env.statistics->activeClauses;
+  }
+}
+
+/**
+ * Append the entry @b kind with @b value to the log. Each entry goes
+ * into the file by a single write(2), so the log is never left with
+ * half a line when a signal terminates the run.
+ */
+void ReplayLog::write(const char* kind, long long value)
+{
+  if (s_fd < 0 || s_filePid != getpid()) {
+    // a forked process must not write into the file of its parent
+    int pid = getpid();
+    vstring name = s_fileName;
+    if (pid != s_recordingPid) {
+      name += "."+Int::toString(pid);
+    }
+    int fd = open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+      s_recording = false;
+      return;
+    }
+    vstring header;
+    if (pid == s_recordingPid) {
+      header = "# vampire replay log, replay with: "+s_commandLine+" --replay "+name+"\n";
+    }
+    else {
+      // the strategy of a forked process is not given by the command line
+      header = "# vampire replay log of process "+Int::toString(pid)+" forked by: "+s_commandLine+"\n";
+    }
+    writeAll(fd, header.c_str(), header.length());
+    // only now closeRecording() may write into the file
+    s_fd = fd;
+    s_filePid = pid;
+  }
+  char buf[128];
+  ASS_L(strlen(kind), 64);
+  char* end = formatEntry(buf, kind, env.statistics->activeClauses, value);
+  writeAll(s_fd, buf, end-buf);
+}
+
+/**
+ * Assign to @b res the next recorded entry and return true, if it is
+ * of kind @b kind. Otherwise report the divergence and return false.
+ */
+bool ReplayLog::nextEntry(const char* kind, Entry& res)
+{
+  CALL("ReplayLog::nextEntry");
+
+  if (s_diverged) {
+    return false;
+  }
+  if (s_nextEntry == s_entries.size()) {
+    diverged(kind, "no more entries");
+    return false;
+  }
+  res = s_entries[s_nextEntry++];
+  if (res.kind != kind || res.activations != env.statistics->activeClauses) {
+    diverged(kind, "a different entry");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Stop replaying decisions, the rest of the run will make its own.
+ */
+void ReplayLog::diverged(const char* kind, const char* reason)
+{
+  CALL("ReplayLog::diverged");
+
+  s_diverged = true;
+  env.beginOutput();
+  env.out() << "WARNING: the run diverged from the replay log after " << env.statistics->activeClauses
+      << " activations, the log has " << reason << " for " << kind
+      << ". The rest of the run is not a replay." << endl;
+  env.endOutput();
+}
+
+/**
+ * Write the entry of the time limit, if it was reached, and close the log.
+ * A run which had not started the proof search yet has nothing to replay.
+ *
+ * This is a termination handler, which also runs when the SIGALRM handler
+ * terminates the run, possibly in the middle of write(). Hence it only
+ * uses write(2) and close(2); the entries of the main flow are complete
+ * lines already in the file.
+ */
+void ReplayLog::closeRecording()
+{
+  if (s_fd >= 0 && s_filePid == getpid()) {
+    if (s_timeLimitActivations >= 0) {
+      char buf[128];
+      char* end = formatEntry(buf, "time_limit", s_timeLimitActivations, s_timeLimitGenerated);
+      writeAll(s_fd, buf, end-buf);
+    }
+    close(s_fd);
+    s_fd = -1;
+  }
+}
+
+}
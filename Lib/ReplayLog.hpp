@@ -0,0 +1,102 @@
+/*
+ * File ReplayLog.hpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file ReplayLog.hpp
+ * Defines class ReplayLog for recording and replaying a proof search.
+ */
+
+#ifndef __ReplayLog__
+#define __ReplayLog__
+
+#include "Stack.hpp"
+#include "VString.hpp"
+
+namespace Lib {
+
+/**
+ * A fully static class recording the decisions of a proof search that
+ * do not follow from the input and the options, and feeding them back
+ * in a later run, so that a slow run can be repeated with statistics or
+ * profiling turned on.
+ *
+ * Random numbers are drawn from a seeded generator, so it is enough to
+ * record the seed. What depends on time are the limit estimates of the
+ * LRS saturation algorithm and the point where the time limit is hit.
+ * Besides these decisions we record checkpoints, such as the number of
+ * generated clauses or the sizes of the splitting model changes, which
+ * are only compared during the replay to detect that the replayed run
+ * went its own way.
+ *
+ * The log is a text file, one entry "kind activations value" per line,
+ * where activations is the number of clauses activated so far.
+ */
+class ReplayLog
+{
+public:
+  static void startRecording(const char* fileName, int argc, char* argv[]);
+  static void startReplay(const char* fileName);
+
+  /** True if the time limit is to be replaced by the point where the recorded run reached it */
+  static bool replayingTimeLimit() { return s_replaying && !s_diverged && s_timeLimitActivations >= 0; }
+
+  static long long decision(const char* kind, long long value);
+  static void checkpoint(const char* kind, long long value);
+
+  static bool timeLimitReached();
+  static void onTimeLimitReached();
+
+  /** A checkpoint of the number of generated clauses is made every this many activations */
+  static const unsigned ACTIVATION_CHECKPOINT_INTERVAL = 64;
+
+private:
+  struct Entry
+  {
+    vstring kind;
+    long long activations;
+    long long value;
+  };
+
+  static void write(const char* kind, long long value);
+  static bool nextEntry(const char* kind, Entry& res);
+  static void diverged(const char* kind, const char* reason);
+  static void closeRecording();
+
+  static bool s_recording;
+  static bool s_replaying;
+  static bool s_diverged;
+
+  /** name of the recorded file */
+  static vstring s_fileName;
+  /** the command line of the recording run without the record_replay option */
+  static vstring s_commandLine;
+  /** the process which started recording, its forks record into their own files */
+  static int s_recordingPid;
+  /** the process which opened @b s_fd */
+  static int s_filePid;
+  /**
+   * Descriptor of the recorded file, or -1. Written by write(2) rather than
+   * stdio, so that closeRecording() may add an entry from a signal handler.
+   */
+  static int s_fd;
+
+  static Stack<Entry> s_entries;
+  /** index of the next entry of @b s_entries to be replayed */
+  static unsigned s_nextEntry;
+  /** number of activations at which the recorded (or recording) run hit the time limit, or -1 */
+  static long long s_timeLimitActivations;
+  /** number of clauses generated by the recorded (or recording) run when it hit the time limit */
+  static long long s_timeLimitGenerated;
+};
+
+}
+
+#endif // __ReplayLog__
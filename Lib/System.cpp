@@ -75,6 +75,7 @@ using namespace Shell;
 bool System::s_initialized = false;
 bool System::s_shouldIgnoreSIGINT = false;
 bool System::s_shouldIgnoreSIGHUP = false;
+volatile sig_atomic_t System::s_statisticsDumpRequested = 0;
 const char* System::s_argv0 = 0;
 
 ///**
@@ -160,6 +161,9 @@ void handleSignal (int sigNum)
 	if(env.options) {
 	  env.beginOutput();
 	  env.out() << "External time out (SIGXCPU) on " << env.options->inputFile() << "\n";
+#if VCALL_SITES && !VDEBUG
+	  Debug::CallSites::printStack(env.out());
+#endif
 	  env.endOutput();
 	} else {
 	  cout << "External time out (SIGXCPU)\n";
@@ -203,12 +207,16 @@ void handleSignal (int sigNum)
 	    env.statistics->print(env.out());
 #if VDEBUG
 	    Debug::Tracer::printStack(env.out());
+#elif VCALL_SITES
+	    Debug::CallSites::printStack(env.out());
 #endif
 	    env.endOutput();
 	  } else {
 	    cout << getpid() << "Aborted by signal " << signalDescription << "\n";
 #if VDEBUG
 	    Debug::Tracer::printStack(cout);
+#elif VCALL_SITES
+	    Debug::CallSites::printStack(cout);
 #endif
 	  }
 	}
@@ -362,6 +370,26 @@ void System::registerForSIGHUPOnParentDeath()
 #endif
 }
 
+/**
+ * Handler of SIGUSR1. Printing the statistics from inside a signal handler
+ * is not safe, so only a flag is set which is checked by the main loop.
+ */
+void handleStatisticsDumpSignal(int sigNum)
+{
+  System::requestStatisticsDump();
+}
+
+/**
+ * Make SIGUSR1 request a dump of the current statistics instead of
+ * terminating Vampire (see the option statistics_dump).
+ */
+void System::enableStatisticsDumpSignal()
+{
+#ifndef _MSC_VER
+  signal(SIGUSR1,handleStatisticsDumpSignal);
+#endif
+}
+
 /**
  * Read command line arguments into @c res and register the executable name
  * (0-th element of @c argv) using the @c registerArgv0() function.
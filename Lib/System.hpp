@@ -20,6 +20,8 @@
 #ifndef __System__
 #define __System__
 
+#include <csignal>
+
 #include "Forwards.hpp"
 
 #include "Array.hpp"
@@ -67,6 +69,13 @@ public:
 
   static void registerForSIGHUPOnParentDeath();
 
+  static void enableStatisticsDumpSignal();
+  /** Called from the signal handler, the dump itself is done by the main loop */
+  static void requestStatisticsDump() { s_statisticsDumpRequested = 1; }
+  /** True if a dump of the statistics was requested and not done yet */
+  static bool statisticsDumpRequested() { return s_statisticsDumpRequested; }
+  static void clearStatisticsDumpRequest() { s_statisticsDumpRequested = 0; }
+
   static void readCmdArgs(int argc, char* argv[], StringStack& res);
 
   /**
@@ -121,6 +130,7 @@ private:
 
   static bool s_shouldIgnoreSIGINT;
   static bool s_shouldIgnoreSIGHUP;
+  static volatile sig_atomic_t s_statisticsDumpRequested;
 
   static const char* s_argv0;
 };
@@ -80,6 +80,8 @@ enum TimeCounterUnit
   TC_INST_GEN_VARIANT_DETECTION,
   TC_INST_GEN_SAT_SOLVING,
   TC_INST_GEN_GEN_INST,
+  TC_INST_GEN_REACTIVATION,
+  TC_INST_GEN_RESTARTS,
   TC_CONSEQUENCE_FINDING,
   TC_TRIVIAL_PREDICATE_REMOVAL,
   TC_SOLVING,
@@ -103,6 +105,7 @@ enum TimeCounterUnit
   TC_LITERAL_SELECTION,
   TC_PASSIVE_CONTAINER_MAINTENANCE,
   TC_THEORY_INST_SIMP,
+  TC_THEORY_INST_SIMP_SMT,
   TC_OTHER,
   __TC_ELEMENT_COUNT,
   __TC_NONE
@@ -142,13 +145,16 @@ public:
   }
 
   static void reinitialize();
+  static long long now();
 
 private:
   void startMeasuring(TimeCounterUnit tcu);
   void stopMeasuring();
 
   static void initialize();
+  static const char* unitName(TimeCounterUnit tcu);
   static void outputSingleStat(TimeCounterUnit tcu, ostream& out);
+  static void outputSingleStatCSV(TimeCounterUnit tcu, ostream& out);
 
   /**
    * Record measurements of all timers currently running,
@@ -184,21 +190,33 @@ private:
    */
   static bool s_initialized;
   /**
-   * Contains number of milliseconds passed in each TimeCounterUnit.
+   * Contains number of nanoseconds passed in each TimeCounterUnit.
    */
-  static int s_measuredTimes[];
+  static long long s_measuredTimes[];
   /**
-   * Contains number of milliseconds passed in each TimeCounterUnit's children.
+   * Contains number of nanoseconds passed in each TimeCounterUnit's children.
    *
    * "ownTime" = "measuredTime" - "measuredTimesChildren"
    */
-  static int s_measuredTimesChildren[];
+  static long long s_measuredTimesChildren[];
   /**
    * For each TimeCounterUnit contains either -1 if the unit is not being
    * measured, or a non-negative number representing initial time of the current
    * block in the unit.
    */
-  static int s_measureInitTimes[];
+  static long long s_measureInitTimes[];
+  /**
+   * Contains number of finished blocks of each TimeCounterUnit.
+   */
+  static unsigned long s_callCounts[];
+
+  static const unsigned HISTOGRAM_BUCKETS = 40;
+  /**
+   * For each TimeCounterUnit, bucket i contains the number of blocks
+   * which took less than 2^i nanoseconds (and at least 2^(i-1)).
+   * The last bucket takes all the longer ones.
+   */
+  static unsigned long s_histograms[][HISTOGRAM_BUCKETS];
 };
 
 };
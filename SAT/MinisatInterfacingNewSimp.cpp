@@ -173,6 +173,26 @@ void MinisatInterfacingNewSimp::addClause(SATClause* cl)
   }
 }
 
+void MinisatInterfacingNewSimp::addClause(const SATLiteralStack& lits)
+{
+  CALL("MinisatInterfacingNewSimp::addClause/2");
+
+  ASS_EQ(_assumptions.size(),0);
+
+  try {
+    static vec<Lit> mcl;
+    mcl.clear();
+
+    for(unsigned i=0;i<lits.size();i++) {
+      mcl.push(vampireLit2Minisat(lits[i]));
+    }
+    // minisat removes duplicate literals and ignores tautologies
+    _solver.addClause(mcl);
+  } catch (Minisat::OutOfMemoryException&){
+      reportMinisatOutOfMemory();
+  }
+}
+
 /**
  * Perform solving and return status.
  */
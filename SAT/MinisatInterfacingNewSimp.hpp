@@ -46,6 +46,14 @@ public:
    * A requirement is that in a clause, each variable occurs at most once.
    */
   virtual void addClause(SATClause* cl) override;
+
+  /**
+   * Add a clause given just by its literals, without creating a SATClause object.
+   *
+   * Can be called only when all assumptions are retracted.
+   * Unlike with addClause(SATClause*), duplicate literals are allowed.
+   */
+  void addClause(const SATLiteralStack& lits);
   
   /**
    * Opportunity to perform in-processing of the clause database.
@@ -57,6 +65,15 @@ public:
     _solver.simplify();
   }
 
+  /**
+   * Do not eliminate any variables during the simplification in the first
+   * call to solve, so that clauses over all the variables can still be added
+   * afterwards.
+   */
+  void disableVariableElimination() {
+    _solver.use_elim = false;
+  }
+
   virtual Status solve(unsigned conflictCountLimit) override;
   
   /**
@@ -118,6 +135,7 @@ public:
     // unsupported by minisat; intentionally no-op
   };
   
+  using SATSolverWithAssumptions::solveUnderAssumptions;
   Status solveUnderAssumptions(const SATLiteralStack& assumps, unsigned conflictCountLimit, bool) override;
 
   virtual SATClause* getRefutation() override { ASSERTION_VIOLATION; }
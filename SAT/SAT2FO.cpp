@@ -47,6 +47,22 @@ SATLiteral SAT2FO::toSAT(Literal* l)
   return SATLiteral(var, pol);
 }
 
+/**
+ * If @c l already has a SAT variable assigned, put the corresponding
+ * SAT literal into @c res and return true. No new variable is created.
+ */
+bool SAT2FO::tryGetSAT(Literal* l, SATLiteral& res) const
+{
+  CALL("SAT2FO::tryGetSAT");
+
+  unsigned var;
+  if(!_posMap.find(Literal::positiveLiteral(l), var)) {
+    return false;
+  }
+  res = SATLiteral(var, l->isPositive());
+  return true;
+}
+
 /**
  * If a FO literal corresponds to the sat literal, return it, otherwise return 0.
  */
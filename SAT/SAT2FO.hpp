@@ -39,6 +39,7 @@ using namespace Kernel;
 class SAT2FO {
 public:
   SATLiteral toSAT(Literal* l);
+  bool tryGetSAT(Literal* l, SATLiteral& res) const;
   SATClause* toSAT(Clause* cl);
   Literal* toFO(SATLiteral sl) const;
 
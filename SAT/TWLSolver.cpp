@@ -300,6 +300,7 @@ SATSolver::Status TWLSolver::solve(unsigned conflictCountLimit) {
     return UNSATISFIABLE;
   }
   
+  long long solvingStart = TimeCounter::now();
   try {
     env.statistics->satTWLSATCalls++;
     doSolving(conflictCountLimit);  // sets _status to SAT or raises
@@ -309,6 +310,7 @@ SATSolver::Status TWLSolver::solve(unsigned conflictCountLimit) {
     ASS(!_generateProofs || _refutation);
     if(_assumptionsAdded){ _unsatisfiableAssumptions=true;}
   }
+  env.statistics->satTWLSolvingTime += TimeCounter::now()-solvingStart;
   
   LOG3((void*)this," solve ",_status);
 
@@ -824,6 +826,20 @@ SATClause* TWLSolver::propagate(unsigned var)
     Watch watch=wit.next();
     SATClause* cl = watch.cl;
 
+    if(watch.binary) {
+      // the blocker is the other literal, no need to look into the clause
+      if(isTrue(watch.blocker)) {
+        continue;
+      }
+      if(isFalse(watch.blocker)) {
+        ASS_REP(isFalse(cl), *cl);
+        return cl;
+      }
+      env.statistics->satTWLBinaryPropagations++;
+      makeForcedAssignment(watch.blocker, cl);
+      continue;
+    }
+
     unsigned litIndex;
     ClauseVisitResult cvr = visitWatchedClause(watch, var, litIndex);
     switch(cvr) {
@@ -899,6 +915,7 @@ void TWLSolver::makeForcedAssignment(SATLiteral lit, SATClause* premise)
   unsigned var = lit.var();
 
   ASS(isUndefined(var));
+  env.statistics->satTWLPropagations++;
   setAssignment(var, lit.polarity());
   _assignmentLevels[var]=_level;
   _assignmentPremises[var]=premise;
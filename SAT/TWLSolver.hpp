@@ -39,15 +39,24 @@ namespace SAT {
 using namespace Lib;
 using namespace Shell;
 
+/**
+ * A watch of a clause in the two-watched-literals index.
+ *
+ * For binary clauses the blocker is always the other literal of the
+ * clause, so such watches can be processed without accessing the
+ * clause itself (which is flagged by @c binary).
+ */
 struct Watch
 {
   Watch() {}
-  Watch(SATClause* cl, SATLiteral blocker) : blocker(blocker), cl(cl)
+  Watch(SATClause* cl, SATLiteral blocker) : blocker(blocker), binary(cl->length()==2), cl(cl)
   {
     CALL("Watch::Watch/2");
     ASS((*cl)[0]==blocker || (*cl)[1]==blocker);
   }
   SATLiteral blocker;
+  /** fits into the padding after blocker, so the watch does not grow */
+  bool binary;
   SATClause* cl;
 };
 
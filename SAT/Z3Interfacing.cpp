@@ -24,6 +24,8 @@
 #include "SATClause.hpp"
 #include "SATInference.hpp"
 
+#include "Debug/RuntimeStatistics.hpp"
+
 #include "Lib/Environment.hpp"
 #include "Lib/System.hpp"
 #include "Kernel/Signature.hpp"
@@ -47,6 +49,7 @@ using namespace Lib;
 Z3Interfacing::Z3Interfacing(const Shell::Options& opts,SAT2FO& s2f, bool unsatCoresForAssumptions):
   _varCnt(0), sat2fo(s2f),_status(SATISFIABLE), _solver(_context),
   _model((_solver.check(),_solver.get_model())), _assumptions(_context), _unsatCoreForAssumptions(unsatCoresForAssumptions),
+  _translations(_context), _sideConditionCnt(0),
   _showZ3(opts.showZ3()),_unsatCoreForRefutations(opts.z3UnsatCores())
 {
   CALL("Z3Interfacing::Z3Interfacing");
@@ -375,10 +378,46 @@ z3::sort Z3Interfacing::getz3sort(unsigned s)
  * - Translates the ground structure
  * - Some interpreted functions/predicates are handled
  */
+/**
+ * Translate the ground term (or literal if @c isLit) @c trm, reusing an earlier
+ * translation of the same shared term if it had no side conditions.
+ */
 z3::expr Z3Interfacing::getz3expr(Term* trm,bool isLit,bool&nameExpression,bool withGuard)
 {
   CALL("Z3Interfacing::getz3expr");
   BYPASSING_ALLOCATOR;
+
+  DHMap<Term*,pair<unsigned,bool>>& cache = _translationCache[withGuard ? 1 : 0];
+  pair<unsigned,bool> cached;
+  if(cache.find(trm,cached)){
+    RSTAT_CTR_INC("z3 translation cache hits");
+    nameExpression = nameExpression || cached.second;
+    return _translations[cached.first];
+  }
+
+  unsigned sideConditionsBefore = _sideConditionCnt;
+  bool named = false;
+  z3::expr res = getz3exprUncached(trm,isLit,named,withGuard);
+  if(_sideConditionCnt == sideConditionsBefore){
+    // the address only identifies the term if it is shared
+    ASS(trm->shared());
+    if(_translations.size() >= TRANSLATION_CACHE_LIMIT){
+      // start afresh rather than keeping every translated term alive in the context
+      _translationCache[0].reset();
+      _translationCache[1].reset();
+      _translations.resize(0);
+    }
+    cache.insert(trm,make_pair(_translations.size(),named));
+    _translations.push_back(res);
+  }
+  nameExpression = nameExpression || named;
+  return res;
+}
+
+z3::expr Z3Interfacing::getz3exprUncached(Term* trm,bool isLit,bool&nameExpression,bool withGuard)
+{
+  CALL("Z3Interfacing::getz3exprUncached");
+  BYPASSING_ALLOCATOR;
   ASS(trm);
   ASS(trm->ground());
 
@@ -879,6 +918,7 @@ SATClause* Z3Interfacing::getRefutation() {
 void Z3Interfacing::addIntNonZero(z3::expr t)
 {
   CALL("Z3Interfacing::addIntNonZero");
+  _sideConditionCnt++;
 
    z3::expr zero = _context.int_val(0);
 
@@ -888,6 +928,7 @@ void Z3Interfacing::addIntNonZero(z3::expr t)
 void Z3Interfacing::addRealNonZero(z3::expr t)
 {
   CALL("Z3Interfacing::addRealNonZero");
+  _sideConditionCnt++;
 
    z3::expr zero = _context.real_val(0);
    z3::expr side = t!=zero;
@@ -907,6 +948,7 @@ void Z3Interfacing::addRealNonZero(z3::expr t)
 void Z3Interfacing::addTruncatedOperations(z3::expr_vector args, Interpretation qi, Interpretation ti, unsigned srt) 
 {
   CALL("Z3Interfacing::addTruncatedOperations");
+  _sideConditionCnt++;
   
   unsigned qfun = env.signature->getInterpretingSymbol(qi);
   Signature::Symbol* qsymb = env.signature->getFunction(qfun); 
@@ -971,6 +1013,7 @@ void Z3Interfacing::addTruncatedOperations(z3::expr_vector args, Interpretation
 void Z3Interfacing::addFloorOperations(z3::expr_vector args, Interpretation qi, Interpretation ti, unsigned srt)
 {
   CALL("Z3Interfacing::addFloorOperations");
+  _sideConditionCnt++;
 
   unsigned qfun = env.signature->getInterpretingSymbol(qi);
   Signature::Symbol* qsymb = env.signature->getFunction(qfun);
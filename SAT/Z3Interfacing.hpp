@@ -181,6 +181,7 @@ public:
   z3::expr getz3expr(Term* trm,bool islit,bool&nameExpression, bool withGuard=false);
   Term* evaluateInModel(Term* trm);
 private:
+  z3::expr getz3exprUncached(Term* trm,bool islit,bool&nameExpression, bool withGuard);
   z3::expr getRepresentation(SATLiteral lit,bool withGuard);
 
   Status _status;
@@ -191,6 +192,21 @@ private:
   z3::expr_vector _assumptions;
   bool _unsatCoreForAssumptions;
 
+  /**
+   * Translations of shared ground terms and literals, separately for the
+   * unguarded [0] and guarded [1] translation, as indices into _translations
+   * together with the nameExpression flag the translation produced.
+   *
+   * Only translations which did not add any side conditions to _solver are
+   * recorded, so they stay valid after reset() (the context is kept).
+   */
+  z3::expr_vector _translations;
+  DHMap<Term*,pair<unsigned,bool>> _translationCache[2];
+  /** Both caches are emptied when _translations reaches this size */
+  static const unsigned TRANSLATION_CACHE_LIMIT = 100000;
+  /** Incremented whenever a translation adds a side condition to _solver */
+  unsigned _sideConditionCnt;
+
   bool _showZ3;
   bool _unsatCoreForRefutations;
 
@@ -16,6 +16,7 @@
  */
 
 #include "Lib/Environment.hpp"
+#include "Lib/ReplayLog.hpp"
 #include "Lib/Timer.hpp"
 #include "Lib/TimeCounter.hpp"
 #include "Lib/VirtualIterator.hpp"
@@ -26,13 +27,6 @@
 
 #include "LRS.hpp"
 
-#define DETERMINISE_LRS_SAVE 0
-#define DETERMINISE_LRS_LOAD 0
-
-#if DETERMINISE_LRS_SAVE || DETERMINISE_LRS_LOAD
-#include <fstream>
-#endif
-
 namespace Saturation
 {
 
@@ -97,15 +91,6 @@ long long LRS::estimatedReachableCount()
 {
   CALL("LRS::estimatedReachableCount");
 
-#if DETERMINISE_LRS_LOAD
-  static std::ifstream infile("lrs_data.txt");
-  long long thing;
-  if (infile >> thing) {
-    cout << "reading " << thing << endl;
-    return thing;
-  }
-#endif
-
   long long processed=env.statistics->activeClauses;
   int currTime=env.timer->elapsedMilliseconds();
   long long timeSpent=currTime-_startTime;
@@ -136,12 +121,9 @@ long long LRS::estimatedReachableCount()
 
   finish:
 
-#if DETERMINISE_LRS_SAVE
-  static std::ofstream outfile("lrs_data.txt");
-  outfile << result << endl;
-#endif
-
-  return result;
+  // the estimate depends on time, so the replay of a run must use the recorded one
+  ReplayLog::checkpoint("generated", env.statistics->generatedClauses);
+  return ReplayLog::decision("lrs", result);
 }
 
 }
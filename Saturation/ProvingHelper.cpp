@@ -16,6 +16,7 @@
  */
 
 #include "Lib/Environment.hpp"
+#include "Lib/ReplayLog.hpp"
 #include "Lib/TimeCounter.hpp"
 #include "Lib/Timer.hpp"
 
@@ -138,7 +139,7 @@ void ProvingHelper::runVampire(Problem& prb, const Options& opt)
   /* Set random seed one more time, this time in the title of "seed for proof search".
    * This should help improve reproducibility when using vampire mode + "--decode" to reply a behavior of a strat from a schedule
    */
-  Lib::Random::setSeed(opt.randomSeed());
+  Lib::Random::setSeed(Lib::ReplayLog::decision("seed", opt.randomSeed()));
 
   env.statistics->phase=Statistics::SATURATION;
   ScopedPtr<MainLoop> salg(MainLoop::createFromOptions(prb, opt));
@@ -15,14 +15,18 @@
  * Implementing SaturationAlgorithm class.
  */
 
+#include <fstream>
+
 #include "Debug/RuntimeStatistics.hpp"
 
 #include "Lib/DHSet.hpp"
 #include "Lib/Environment.hpp"
 #include "Lib/Metaiterators.hpp"
+#include "Lib/ReplayLog.hpp"
 #include "Lib/SharedSet.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/Timer.hpp"
+#include "Lib/TimeCounter.hpp"
 #include "Lib/VirtualIterator.hpp"
 #include "Lib/System.hpp"
 #include "Lib/STL.hpp"
@@ -83,6 +87,7 @@
 #include "Shell/UIHelper.hpp"
 
 #include "Splitter.hpp"
+#include "SaturationTrace.hpp"
 
 #include "ConsequenceFinder.hpp"
 #include "LabelFinder.hpp"
@@ -111,6 +116,39 @@ using namespace Saturation;
 
 SaturationAlgorithm* SaturationAlgorithm::s_instance = 0;
 
+/**
+ * Measures the time and memory spent by inference engines since the
+ * last charge, so that they can be attributed to the inference rule
+ * of a clause once the clause has been derived.
+ */
+class InferenceCostMeasurement
+{
+public:
+  InferenceCostMeasurement(bool enabled) : _enabled(enabled), _time(0), _memory(0) { restart(); }
+
+  void restart()
+  {
+    if (_enabled) {
+      _time = TimeCounter::now();
+      _memory = Allocator::liveBytes();
+    }
+  }
+
+  /** Add the cost since the last charge to @b cost and start measuring anew */
+  void chargeTo(Statistics::InferenceRuleCost& cost)
+  {
+    if (_enabled) {
+      cost.time += TimeCounter::now()-_time;
+      cost.memory += Allocator::liveBytes()-_memory;
+      restart();
+    }
+  }
+private:
+  bool _enabled;
+  long long _time;
+  long long _memory;
+};
+
 std::unique_ptr<PassiveClauseContainer> makeLevel0(bool isOutermost, const Options& opt, vstring name)
 {
   return Lib::make_unique<AWPassiveClauseContainer>(isOutermost, opt, name + "AWQ");
@@ -214,6 +252,10 @@ SaturationAlgorithm::SaturationAlgorithm(Problem& prb, const Options& opt)
   ASS_EQ(s_instance, 0);  //there can be only one saturation algorithm at a time
 
   _activationLimit = opt.activationLimit();
+  _measureInferenceCosts = opt.timeStatistics();
+  if (opt.saturationTrace() != "off") {
+    _trace = new SaturationTrace(opt.saturationTrace(), opt.saturationTraceInterval());
+  }
 
   _ordering = OrderingSP(Ordering::create(prb, opt));
   if (!Ordering::trySetGlobalOrdering(_ordering)) {
@@ -864,12 +906,19 @@ void SaturationAlgorithm::addUnprocessedClause(Clause* cl)
   env.checkTimeSometime<64>();
 
 
-  cl=doImmediateSimplification(cl);
-  if (!cl) {
+  Clause* simplCl=doImmediateSimplification(cl);
+  // a clause replaced by immediate simplification is counted once, under
+  // the rule of the replacement, whose further fate is counted there
+  Statistics::InferenceRuleCost& cost = env.statistics->inferenceRuleCost((simplCl ? simplCl : cl)->inference().rule());
+  cost.clauses++;
+  if (!simplCl) {
+    cost.discarded++;
     return;
   }
+  cl=simplCl;
 
   if (cl->isEmpty()) {
+    cost.retained++;
     handleEmptyClause(cl);
     return;
   }
@@ -950,6 +999,7 @@ bool SaturationAlgorithm::forwardSimplify(Clause* cl)
   }
 
   FwSimplList::Iterator fsit(_fwSimplifiers);
+  InferenceCostMeasurement measurement(_measureInferenceCosts);
 
   while (fsit.hasNext()) {
     ForwardSimplificationEngine* fse=fsit.next();
@@ -960,12 +1010,17 @@ bool SaturationAlgorithm::forwardSimplify(Clause* cl)
 
       if (fse->perform(cl,replacement,premises)) {
         if (replacement) {
+          measurement.chargeTo(env.statistics->inferenceRuleCost(replacement->inference().rule()));
           addNewClause(replacement);
         }
+        else {
+          measurement.chargeTo(env.statistics->forwardSimplificationWithoutConclusion);
+        }
         onClauseReduction(cl, replacement, premises);
 
         return false;
       }
+      measurement.chargeTo(env.statistics->forwardSimplificationWithoutConclusion);
     }
   }
 
@@ -990,10 +1045,12 @@ void SaturationAlgorithm::backwardSimplify(Clause* cl)
 
 
   BwSimplList::Iterator bsit(_bwSimplifiers);
+  InferenceCostMeasurement measurement(_measureInferenceCosts);
   while (bsit.hasNext()) {
     BackwardSimplificationEngine* bse=bsit.next();
 
     BwSimplificationRecordIterator simplifications;
+    measurement.restart();
     bse->perform(cl,simplifications);
     while (simplifications.hasNext()) {
       BwSimplificationRecord srec=simplifications.next();
@@ -1003,8 +1060,12 @@ void SaturationAlgorithm::backwardSimplify(Clause* cl)
       Clause* replacement=srec.replacement;
 
       if (replacement) {
+        measurement.chargeTo(env.statistics->inferenceRuleCost(replacement->inference().rule()));
 	addNewClause(replacement);
       }
+      else {
+        measurement.chargeTo(env.statistics->backwardSimplificationWithoutConclusion);
+      }
       onClauseReduction(redundant, replacement, cl, false);
 
       //we must remove the redundant clause before adding its replacement,
@@ -1016,7 +1077,9 @@ void SaturationAlgorithm::backwardSimplify(Clause* cl)
       removeActiveOrPassiveClause(redundant);
 
       redundant->decRefCnt();
+      measurement.restart();
     }
+    measurement.chargeTo(env.statistics->backwardSimplificationWithoutConclusion);
   }
 }
 
@@ -1123,13 +1186,20 @@ bool SaturationAlgorithm::activate(Clause* cl)
   ASS_EQ(cl->store(), Clause::SELECTED);
   cl->setStore(Clause::ACTIVE);
   env.statistics->activeClauses++;
+  if (env.statistics->activeClauses % ReplayLog::ACTIVATION_CHECKPOINT_INTERVAL == 0) {
+    ReplayLog::checkpoint("generated", env.statistics->generatedClauses);
+  }
   _active->add(cl);
 
 
+    // the clauses are generated lazily, so the cost of an inference is
+    // what we spend in the iterator until it yields the clause
+    InferenceCostMeasurement measurement(_measureInferenceCosts);
     ClauseIterator toAdd= pvi(getConcatenatedIterator(instances,_generator->generateClauses(cl)));
 
     while (toAdd.hasNext()) {
       Clause* genCl=toAdd.next();
+      measurement.chargeTo(env.statistics->inferenceRuleCost(genCl->inference().rule()));
 
       addNewClause(genCl);
 
@@ -1144,6 +1214,7 @@ bool SaturationAlgorithm::activate(Clause* cl)
           onParenthood(genCl, premCl);
         }
       }
+      measurement.restart();
     }
 
   _clauseActivationInProgress=false;
@@ -1177,12 +1248,15 @@ start:
     Clause* c = _unprocessed->pop();
     ASS(!isRefutation(c));
 
+    Statistics::InferenceRuleCost& cost = env.statistics->inferenceRuleCost(c->inference().rule());
     if (forwardSimplify(c)) {
+      cost.retained++;
       onClauseRetained(c);
       addToPassive(c);
       ASS_EQ(c->store(), Clause::PASSIVE);
     }
     else {
+      cost.discarded++;
       ASS_EQ(c->store(), Clause::UNPROCESSED);
       c->setStore(Clause::NONE);
     }
@@ -1251,6 +1325,28 @@ UnitList* SaturationAlgorithm::collectSaturatedSet()
   return res;
 }
 
+/**
+ * Append the current statistics to the file given by the option
+ * statistics_dump, as requested by SIGUSR1. The run then continues.
+ */
+void SaturationAlgorithm::dumpStatistics()
+{
+  CALL("SaturationAlgorithm::dumpStatistics");
+
+  System::clearStatisticsDumpRequest();
+
+  vstring fileName = getOptions().statisticsDump();
+  BYPASSING_ALLOCATOR; // for ofstream
+  ofstream out(fileName.c_str(), ios::app);
+  if (!out) {
+    // not worth stopping the proof attempt for
+    return;
+  }
+  addCommentSignForSZS(out);
+  out << "Statistics of the running process " << System::getPID() << endl;
+  env.statistics->print(out, true);
+}
+
 /**
  *
  * This function may throw RefutationFoundException and TimeLimitExceededException.
@@ -1259,8 +1355,20 @@ void SaturationAlgorithm::doOneAlgorithmStep()
 {
   CALL("SaturationAlgorithm::doOneAlgorithmStep");
 
+  if (System::statisticsDumpRequested()) {
+    dumpStatistics();
+  }
+
+  if (_trace) {
+    _trace->onStepStart(*this);
+  }
+
   doUnprocessedLoop();
 
+  if (_trace) {
+    _trace->onPhaseEnd(SaturationTrace::UNPROCESSED_LOOP);
+  }
+
   if (_passive->isEmpty()) {
     MainLoopResult::TerminationReason termReason =
 	isComplete() ? Statistics::SATISFIABLE : Statistics::REFUTATION_NOT_FOUND;
@@ -1288,6 +1396,10 @@ void SaturationAlgorithm::doOneAlgorithmStep()
   ASS_EQ(cl->store(),Clause::PASSIVE);
   cl->setStore(Clause::SELECTED);
 
+  if (_trace) {
+    _trace->onPhaseEnd(SaturationTrace::CLAUSE_SELECTION);
+  }
+
   if (!handleClauseBeforeActivation(cl)) {
     return;
   }
@@ -1296,6 +1408,10 @@ void SaturationAlgorithm::doOneAlgorithmStep()
   if (!isActivated) {
     handleUnsuccessfulActivation(cl);
   }
+
+  if (_trace) {
+    _trace->onPhaseEnd(SaturationTrace::ACTIVATION);
+  }
 }
 
 
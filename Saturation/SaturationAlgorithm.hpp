@@ -100,6 +100,7 @@ public:
   ClauseIterator activeClauses();
 
   PassiveClauseContainer* getPassiveClauseContainer() { return _passive.get(); }
+  ActiveClauseContainer* getActiveClauseContainer() { return _active; }
   IndexManager* getIndexManager() { return _imgr.ptr(); }
   AnswerLiteralManager* getAnswerLiteralManager() { return _answerLiteralManager; }
   Ordering& getOrdering() const {  return *_ordering; }
@@ -159,6 +160,7 @@ private:
   LiteralSelector& getSosLiteralSelector();
 
   void handleEmptyClause(Clause* cl);
+  void dumpStatistics();
   Clause* doImmediateSimplification(Clause* cl);
   MainLoopResult saturateImpl();
   SmartPtr<IndexManager> _imgr;
@@ -217,11 +219,16 @@ protected:
    */
   ScopedPtr<LiteralSelector> _sosLiteralSelector;
 
+  /** Trace of the given clause loop, if requested by the saturation_trace option */
+  ScopedPtr<SaturationTrace> _trace;
+
 
   // counters
 
   /** Number of clauses that entered the unprocessed container */
   unsigned _generatedClauseCount;
+  /** True if time and memory of inferences are attributed to inference rules */
+  bool _measureInferenceCosts;
 
   unsigned _activationLimit;
 private:
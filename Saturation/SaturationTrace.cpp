@@ -0,0 +1,208 @@
+/*
+ * File SaturationTrace.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SaturationTrace.cpp
+ * Implements class SaturationTrace.
+ */
+
+#include "Lib/Environment.hpp"
+#include "Lib/Exception.hpp"
+#include "Lib/TimeCounter.hpp"
+
+#include "Indexing/Index.hpp"
+#include "Indexing/IndexManager.hpp"
+
+#include "Shell/Statistics.hpp"
+
+#include "ClauseContainer.hpp"
+#include "SaturationAlgorithm.hpp"
+
+#include "SaturationTrace.hpp"
+
+namespace Saturation
+{
+
+using namespace Indexing;
+
+/** Version of the trace format, to be increased whenever the fields change */
+static const unsigned TRACE_FORMAT_VERSION = 1;
+
+static const char* phaseName(SaturationTrace::Phase phase)
+{
+  switch(phase) {
+  case SaturationTrace::UNPROCESSED_LOOP:
+    return "unprocessed_loop_ns";
+  case SaturationTrace::CLAUSE_SELECTION:
+    return "clause_selection_ns";
+  case SaturationTrace::ACTIVATION:
+    return "activation_ns";
+  default:
+    ASSERTION_VIOLATION;
+  }
+}
+
+static const char* indexName(IndexType type)
+{
+  switch(type) {
+  case GENERATING_SUBST_TREE:
+    return "generating_subst_tree";
+  case SIMPLIFYING_SUBST_TREE:
+    return "simplifying_subst_tree";
+  case SIMPLIFYING_UNIT_CLAUSE_SUBST_TREE:
+    return "simplifying_unit_clause_subst_tree";
+  case GENERATING_UNIT_CLAUSE_SUBST_TREE:
+    return "generating_unit_clause_subst_tree";
+  case GENERATING_NON_UNIT_CLAUSE_SUBST_TREE:
+    return "generating_non_unit_clause_subst_tree";
+  case SUPERPOSITION_SUBTERM_SUBST_TREE:
+    return "superposition_subterm_subst_tree";
+  case SUPERPOSITION_LHS_SUBST_TREE:
+    return "superposition_lhs_subst_tree";
+  case DEMODULATION_SUBTERM_SUBST_TREE:
+    return "demodulation_subterm_subst_tree";
+  case DEMODULATION_LHS_SUBST_TREE:
+    return "demodulation_lhs_subst_tree";
+  case FW_SUBSUMPTION_CODE_TREE:
+    return "fw_subsumption_code_tree";
+  case FW_SUBSUMPTION_SUBST_TREE:
+    return "fw_subsumption_subst_tree";
+  case BW_SUBSUMPTION_SUBST_TREE:
+    return "bw_subsumption_subst_tree";
+  case FSD_SUBST_TREE:
+    return "fsd_subst_tree";
+  case REWRITE_RULE_SUBST_TREE:
+    return "rewrite_rule_subst_tree";
+  case GLOBAL_SUBSUMPTION_INDEX:
+    return "global_subsumption_index";
+  case ACYCLICITY_INDEX:
+    return "acyclicity_index";
+  }
+  ASSERTION_VIOLATION;
+}
+
+SaturationTrace::SaturationTrace(vstring fileName, unsigned interval)
+: _interval(interval), _step(0)
+{
+  CALL("SaturationTrace::SaturationTrace");
+  ASS_G(interval,0);
+
+  {
+    BYPASSING_ALLOCATOR; // for ofstream
+    _out.open(fileName.c_str(), ios::out | ios::binary);
+  }
+  if (!_out) {
+    USER_ERROR("Cannot open saturation trace file: "+fileName);
+  }
+  writeHeader();
+
+  for (unsigned i=0; i<PHASE_COUNT; i++) {
+    _phaseTimes[i] = 0;
+  }
+  _startTime = TimeCounter::now();
+  _lastTime = _startTime;
+}
+
+SaturationTrace::~SaturationTrace()
+{
+  CALL("SaturationTrace::~SaturationTrace");
+
+  BYPASSING_ALLOCATOR;
+  _out.close();
+}
+
+/**
+ * Write @b bytes lowest bytes of @b num, least significant first.
+ */
+void SaturationTrace::writeNumber(unsigned long long num, unsigned bytes)
+{
+  for (unsigned i=0; i<bytes; i++) {
+    _out.put(static_cast<char>(num & 0xff));
+    num >>= 8;
+  }
+}
+
+void SaturationTrace::writeHeader()
+{
+  CALL("SaturationTrace::writeHeader");
+
+  static const char* const fixedFields[] = {
+    "step", "time_ns", "passive", "active", "memory_bytes", "sat_calls"
+  };
+  unsigned fixedCnt = sizeof(fixedFields)/sizeof(fixedFields[0]);
+
+  BYPASSING_ALLOCATOR;
+
+  _out.write("VSTR", 4);
+  writeNumber(TRACE_FORMAT_VERSION, 4);
+  writeNumber(fixedCnt+PHASE_COUNT+ACYCLICITY_INDEX, 4);
+  for (unsigned i=0; i<fixedCnt; i++) {
+    _out << fixedFields[i] << '\0';
+  }
+  for (unsigned i=0; i<PHASE_COUNT; i++) {
+    _out << phaseName(static_cast<Phase>(i)) << '\0';
+  }
+  // IndexType starts at 1
+  for (unsigned i=1; i<=ACYCLICITY_INDEX; i++) {
+    _out << indexName(static_cast<IndexType>(i)) << '\0';
+  }
+}
+
+/**
+ * Called at the start of each iteration of the given clause loop,
+ * writes a sample every @b _interval iterations.
+ */
+void SaturationTrace::onStepStart(SaturationAlgorithm& alg)
+{
+  CALL("SaturationTrace::onStepStart");
+
+  if (_step%_interval==0) {
+    writeSample(alg);
+  }
+  _step++;
+  _lastTime = TimeCounter::now();
+}
+
+/**
+ * Attribute the time since the end of the previous phase to @b phase
+ */
+void SaturationTrace::onPhaseEnd(Phase phase)
+{
+  long long time = TimeCounter::now();
+  _phaseTimes[phase] += time-_lastTime;
+  _lastTime = time;
+}
+
+void SaturationTrace::writeSample(SaturationAlgorithm& alg)
+{
+  CALL("SaturationTrace::writeSample");
+
+  BYPASSING_ALLOCATOR;
+
+  writeNumber(_step, 8);
+  writeNumber(TimeCounter::now()-_startTime, 8);
+  writeNumber(alg.getPassiveClauseContainer()->sizeEstimate(), 8);
+  writeNumber(alg.getActiveClauseContainer()->sizeEstimate(), 8);
+  writeNumber(Allocator::getUsedMemory(), 8);
+  writeNumber(env.statistics->satSplitSolverCalls, 8);
+  for (unsigned i=0; i<PHASE_COUNT; i++) {
+    writeNumber(_phaseTimes[i], 8);
+  }
+  IndexManager* imgr = alg.getIndexManager();
+  for (unsigned i=1; i<=ACYCLICITY_INDEX; i++) {
+    IndexType type = static_cast<IndexType>(i);
+    writeNumber(imgr->contains(type) ? imgr->get(type)->clauseCount() : 0, 8);
+  }
+  // keep the trace usable when the run gets killed
+  _out.flush();
+}
+
+}
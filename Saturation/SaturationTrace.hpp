@@ -0,0 +1,77 @@
+/*
+ * File SaturationTrace.hpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file SaturationTrace.hpp
+ * Defines class SaturationTrace.
+ */
+
+#ifndef __SaturationTrace__
+#define __SaturationTrace__
+
+#include <fstream>
+
+#include "Forwards.hpp"
+
+#include "Lib/Allocator.hpp"
+
+namespace Saturation {
+
+using namespace Lib;
+
+/**
+ * Writes samples of the state of the given clause loop into a binary file
+ * (see the option saturation_trace).
+ *
+ * The file starts with the magic "VSTR", the format version and the number
+ * of fields of a sample (both as 32-bit unsigned integers), followed by the
+ * zero-terminated names of the fields. After that come the samples, each of
+ * them being a sequence of 64-bit unsigned integers, one for every field.
+ * All numbers are little-endian. scripts/saturation_trace_plot.py reads it.
+ */
+class SaturationTrace {
+public:
+  CLASS_NAME(SaturationTrace);
+  USE_ALLOCATOR(SaturationTrace);
+
+  /** Parts of a given clause loop iteration whose time is measured */
+  enum Phase {
+    UNPROCESSED_LOOP,
+    CLAUSE_SELECTION,
+    ACTIVATION,
+    PHASE_COUNT
+  };
+
+  SaturationTrace(vstring fileName, unsigned interval);
+  ~SaturationTrace();
+
+  void onStepStart(SaturationAlgorithm& alg);
+  void onPhaseEnd(Phase phase);
+
+private:
+  void writeHeader();
+  void writeSample(SaturationAlgorithm& alg);
+  void writeNumber(unsigned long long num, unsigned bytes);
+
+  ofstream _out;
+  unsigned _interval;
+  unsigned long long _step;
+
+  long long _startTime;
+  /** end of the last measured phase */
+  long long _lastTime;
+  /** nanoseconds spent in each Phase */
+  long long _phaseTimes[PHASE_COUNT];
+};
+
+}
+
+#endif // __SaturationTrace__
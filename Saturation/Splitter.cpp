@@ -23,6 +23,7 @@
 #include "Lib/Environment.hpp"
 #include "Lib/IntUnionFind.hpp"
 #include "Lib/Metaiterators.hpp"
+#include "Lib/ReplayLog.hpp"
 #include "Lib/SharedSet.hpp"
 #include "Lib/TimeCounter.hpp"
 
@@ -134,6 +135,7 @@ void SplittingBranchSelector::updateVarCnt()
   // index by var, but ignore slot 0
   _selected.expand(splitLvlCnt+1);
   _trueInCCModel.expand(satVarCnt+1);
+  _lastAsgn.expand(satVarCnt+1,SATSolver::NOT_KNOWN);
 
   // solver may be doing the same, but only internally
   _solver->ensureVarCount(satVarCnt);
@@ -159,6 +161,21 @@ void SplittingBranchSelector::considerPolarityAdvice(SATLiteral lit)
   }
 }
 
+/**
+ * Forget the assignment of @b satVar from the last model, so that
+ * the next recomputeModel reconsiders its components even if the
+ * variable keeps its value. To be called when a new name starts
+ * being used for an already existing variable.
+ */
+void SplittingBranchSelector::invalidateLastAssignment(unsigned satVar)
+{
+  CALL("SplittingBranchSelector::invalidateLastAssignment");
+
+  if(satVar<_lastAsgn.size()) {
+    _lastAsgn[satVar] = SATSolver::NOT_KNOWN;
+  }
+}
+
 static Color colorFromPossiblyDeepFOConversion(SATClause* scl,Unit*& u)
 {
   /* all the clauses added to AVATAR are FO_CONVERSIONs except when there is a duplicate literal
@@ -437,6 +454,7 @@ SATSolver::Status SplittingBranchSelector::processDPConflicts()
     {
     	TimeCounter tca(TC_SAT_SOLVER);
     	
+      env.statistics->satSplitSolverCalls++;
       if (_solver->solve() == SATSolver::UNSATISFIABLE) {
         return SATSolver::UNSATISFIABLE;
       }
@@ -595,6 +613,7 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
     if (randomize) {
       _solver->randomizeForNextAssignment(maxSatVar);
     }
+    env.statistics->satSplitSolverCalls++;
     stat = _solver->solve();
   }
   if (stat == SATSolver::SATISFIABLE) {
@@ -609,6 +628,12 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
   }
   ASS_EQ(stat,SATSolver::SATISFIABLE);
 
+  env.statistics->satSplitModelRecomputations++;
+  if(_lastAsgn.size()<=maxSatVar) {
+    // variables may have been introduced without updateVarCnt (e.g. by conflict clauses)
+    _lastAsgn.expand(maxSatVar+1,SATSolver::NOT_KNOWN);
+  }
+
   unsigned _usedcnt=0; // for the statistics below
   for(unsigned i=1; i<=maxSatVar; i++) {
     SATSolver::VarAssignment asgn = getSolverAssimentConsideringCCModel(i);
@@ -623,12 +648,20 @@ void SplittingBranchSelector::recomputeModel(SplitLevelStack& addedComps, SplitL
       throw MainLoop::MainLoopFinishedException(Statistics::REFUTATION_NOT_FOUND);
     }
 
-    updateSelection(i, asgn, addedComps, removedComps);
-    
+    // components of a variable which kept its value are already (de)selected
+    if (asgn != _lastAsgn[i]) {
+      _lastAsgn[i] = asgn;
+      env.statistics->satSplitVarFlips++;
+      updateSelection(i, asgn, addedComps, removedComps);
+    }
+
     if (asgn != SATSolver::DONT_CARE) {
       _usedcnt++;
     }
   }
+  // the model follows from the seeded solver, the checkpoints only tell where a replay went wrong
+  ReplayLog::checkpoint("split_added", addedComps.size());
+  ReplayLog::checkpoint("split_removed", removedComps.size());
   /*
   if(maxSatVar>=1){
     int percent = (_usedcnt *100) / maxSatVar;
@@ -648,7 +681,7 @@ vstring Splitter::splPrefix = "";
 
 Splitter::Splitter()
 : _deleteDeactivated(Options::SplittingDeleteDeactivated::ON), _branchSelector(*this),
-  _clausesAdded(false), _haveBranchRefutation(false)
+  _clausesAdded(false), _haveBranchRefutation(false), _activeLevelsVersion(0)
 {
   CALL("Splitter::Splitter");
   if(env.options->proof()==Options::Proof::TPTP){
@@ -1044,6 +1077,10 @@ bool Splitter::getComponents(Clause* cl, Stack<LiteralStack>& acc)
 
   for(unsigned i=0;i<clen;i++) {
     Literal* lit=(*cl)[i];
+    if(lit->ground()) {
+      // a ground literal is always a component of its own
+      continue;
+    }
     VariableIterator vit(lit);
     while(vit.hasNext()) {
       unsigned master=varMasters.findOrInsert(vit.next().var(), i);
@@ -1171,6 +1208,26 @@ bool Splitter::tryGetExistingComponentName(unsigned size, Literal* const * lits,
 {
   CALL("Splitter::tryGetExistingComponentName");
 
+  if(size==1 && lits[0]->ground()) {
+    // Ground singleton components are named directly by the SAT variable
+    // of their (perfectly shared) literal, so the variant index need not
+    // be consulted: the literal either has a name with a record, or it
+    // has not been seen as a component yet.
+    SATLiteral satLit;
+    if(!_sat2fo.tryGetSAT(lits[0], satLit)) {
+      return false;
+    }
+    SplitLevel name = getNameFromLiteralUnsafe(satLit);
+    if(name>=_db.size() || !_db[name]) {
+      return false;
+    }
+    RSTAT_CTR_INC("ssat_ground_component_fast_lookups");
+    comp = name;
+    compCl = _db[name]->component;
+    ASS_EQ(_compNames.get(compCl),name);
+    return true;
+  }
+
   ClauseIterator existingComponents;
   { 
     TimeCounter tc(TC_SPLITTING_COMPONENT_INDEX_USAGE);
@@ -1330,6 +1387,9 @@ SplitLevel Splitter::addGroundComponent(Literal* lit, Clause* orig, Clause*& com
     // ... in the respective previous pass through this method 
   }
   ASS_L(compName,_db.size());
+  // the variable may already have a value in the current model,
+  // which did not select anything so far
+  _branchSelector.invalidateLastAssignment(satLit.var());
 
   if(_complBehavior!=Options::SplittingAddComplementary::NONE) {
     //we insert both literal and its negation
@@ -1683,6 +1743,10 @@ void Splitter::addComponents(const SplitLevelStack& toAdd)
 {
   CALL("Splitter::addComponents");
 
+  if(toAdd.isNonEmpty()) {
+    _activeLevelsVersion++;
+  }
+
   SplitLevelStack::ConstIterator slit(toAdd);
   while(slit.hasNext()) {
     SplitLevel sl = slit.next();
@@ -1726,6 +1790,10 @@ void Splitter::removeComponents(const SplitLevelStack& toRemove)
 {
   CALL("Splitter::removeComponents");
   ASS(_sa->clausesFlushed());
+
+  if(toRemove.isNonEmpty()) {
+    _activeLevelsVersion++;
+  }
   
   SplitSet* backtracked = SplitSet::getFromArray(toRemove.begin(), toRemove.size());
 
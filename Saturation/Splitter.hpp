@@ -22,6 +22,7 @@
 
 #include "Lib/Allocator.hpp"
 #include "Lib/ArrayMap.hpp"
+#include "Lib/DArray.hpp"
 #include "Lib/DHMap.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/ScopedPtr.hpp"
@@ -74,6 +75,7 @@ _solver=0;
 
   void updateVarCnt();
   void considerPolarityAdvice(SATLiteral lit);
+  void invalidateLastAssignment(unsigned satVar);
 
   void addSatClauseToSolver(SATClause* cl, bool refutation);
   void recomputeModel(SplitLevelStack& addedComps, SplitLevelStack& removedComps, bool randomize = false);
@@ -114,6 +116,13 @@ private:
    */
   ArraySet _trueInCCModel;
 
+  /**
+   * Assignment of each SAT variable in the last model, indexed by variable.
+   * Only variables whose value differs from the one recorded here
+   * need to have their components (de)selected in recomputeModel.
+   */
+  DArray<SATSolver::VarAssignment> _lastAsgn;
+
 #if VDEBUG
   unsigned lastCheckedVar;
 #endif
@@ -298,7 +307,10 @@ private:
    * and will invariably change the SAT model.
    */
   RCClauseStack _fastClauses;
-  
+
+  /** Incremented by addComponents and removeComponents */
+  unsigned _activeLevelsVersion;
+
   SaturationAlgorithm* _sa;
 
 public:
@@ -310,6 +322,8 @@ public:
     ASS_REP(lev<_db.size(), lev);
     return (_db[lev]!=0 && _db[lev]->active);
   }
+  /** Changes whenever some split level gets activated or deactivated */
+  unsigned activeLevelsVersion() const { return _activeLevelsVersion; }
 };
 
 }
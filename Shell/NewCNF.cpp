@@ -118,11 +118,13 @@ void NewCNF::clausify(FormulaUnit* unit,Stack<Clause*>& output)
   _freeVars.reset();
 
   { // destroy the cached substitution entries
-    DHMap<BindingList*,Substitution*>::DelIterator dIt(_substitutionsByBindings);
-    while (dIt.hasNext()) {
-      delete dIt.next();
-      dIt.del();
+    // (reset rather than deleting entry by entry, the deleted entries would
+    // otherwise keep growing the map, which we scan for every formula)
+    DHMap<BindingList*,Substitution*>::Iterator sIt(_substitutionsByBindings);
+    while (sIt.hasNext()) {
+      delete sIt.next();
     }
+    _substitutionsByBindings.reset();
   }
 
   ASS(_queue.isEmpty());
@@ -1033,24 +1035,18 @@ void NewCNF::process(QuantifiedFormula* g, Occurrences &occurrences)
 
   // empty the skolem caches
   _skolemsByBindings.reset();
-  DHMap<VarSet*,BindingList*>::DelIterator dIt(_skolemsByFreeVars);
+  DHMap<VarSet*,BindingList*>::Iterator dIt(_skolemsByFreeVars);
   while (dIt.hasNext()) {
-    VarSet* vars;
-    BindingList* bindings;
-    dIt.next(vars,bindings);
-    BindingList::destroy(bindings);
-    dIt.del();
+    BindingList::destroy(dIt.next());
   }
+  _skolemsByFreeVars.reset();
 
   _foolSkolemsByBindings.reset();
-  DHMap<VarSet*,BindingList*>::DelIterator fdit(_foolSkolemsByFreeVars);
+  DHMap<VarSet*,BindingList*>::Iterator fdit(_foolSkolemsByFreeVars);
   while (fdit.hasNext()) {
-    VarSet* vars;
-    BindingList* bindings;
-    fdit.next(vars, bindings);
-    BindingList::destroy(bindings);
-    fdit.del();
+    BindingList::destroy(fdit.next());
   }
+  _foolSkolemsByFreeVars.reset();
 
   // Note that the formula under quantifier reuses the quantified formula's occurrences
   enqueue(g->qarg(), occurrences);
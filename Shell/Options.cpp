@@ -333,6 +333,73 @@ void Options::init()
     _lookup.insert(&_timeStatistics);
     _timeStatistics.tag(OptionTag::OUTPUT);
 
+    _timeStatisticsFormat = ChoiceOptionValue<TimeStatisticsFormat>("time_statistics_format","tstatf",TimeStatisticsFormat::TEXT,{"csv","text"});
+    _timeStatisticsFormat.description="How to report time statistics. csv gives one line per measured unit with the number of calls,"
+    " the total and own time in nanoseconds and a histogram of call latencies (bucket i counts calls taking less than 2^i ns).";
+    _lookup.insert(&_timeStatisticsFormat);
+    _timeStatisticsFormat.tag(OptionTag::OUTPUT);
+    _timeStatisticsFormat.reliesOn(_timeStatistics.is(equal(true)));
+
+    _saturationTrace = StringOptionValue("saturation_trace","","off");
+    _saturationTrace.description="File to which a binary trace of the given clause loop is written, with one sample every"
+    " saturation_trace_interval iterations. The trace can be plotted by scripts/saturation_trace_plot.py.";
+    _lookup.insert(&_saturationTrace);
+    _saturationTrace.tag(OptionTag::OUTPUT);
+
+    _saturationTraceInterval = UnsignedOptionValue("saturation_trace_interval","",100);
+    _saturationTraceInterval.description="Number of given clause loop iterations between two samples of the saturation trace";
+    _lookup.insert(&_saturationTraceInterval);
+    _saturationTraceInterval.tag(OptionTag::OUTPUT);
+    _saturationTraceInterval.addConstraint(greaterThan(0u));
+    _saturationTraceInterval.reliesOn(_saturationTrace.is(notEqual<vstring>("off")));
+
+    _allocatorTelemetry = BoolOptionValue("allocator_telemetry","",false);
+    _allocatorTelemetry.description="Count live and peak bytes and the number of allocations for each class of objects"
+    " and report them with the statistics, together with the free list fragmentation and unused page capacity of the allocator."
+    " Makes every allocation slightly more expensive.";
+    _lookup.insert(&_allocatorTelemetry);
+    _allocatorTelemetry.tag(OptionTag::OUTPUT);
+
+    _statisticsDump = StringOptionValue("statistics_dump","","off");
+    _statisticsDump.description="File to which the current statistics (all of them, including time statistics if enabled)"
+    " are appended whenever Vampire receives SIGUSR1. The run continues after the dump, which is done at the start"
+    " of the next iteration of the given clause loop.";
+    _lookup.insert(&_statisticsDump);
+    _statisticsDump.tag(OptionTag::OUTPUT);
+
+    _sampleProfile = StringOptionValue("sample_profile","","off");
+    _sampleProfile.description="File to which a flat profile of the functions marked by CALL is written at the end of the run."
+    " The profile is built by sampling the stack of CALL sites, so it needs a release build with VCALL_SITES=1.";
+    _lookup.insert(&_sampleProfile);
+    _sampleProfile.tag(OptionTag::OUTPUT);
+    _sampleProfile.setExperimental();
+
+    _sampleProfileInterval = UnsignedOptionValue("sample_profile_interval","",1000);
+    _sampleProfileInterval.description="Microseconds of CPU time between two samples of the sample profile";
+    _lookup.insert(&_sampleProfileInterval);
+    _sampleProfileInterval.tag(OptionTag::OUTPUT);
+    _sampleProfileInterval.setExperimental();
+    _sampleProfileInterval.addConstraint(greaterThan(0u));
+    _sampleProfileInterval.reliesOn(_sampleProfile.is(notEqual<vstring>("off")));
+
+    _recordReplay = StringOptionValue("record_replay","","off");
+    _recordReplay.description="File into which the decisions of the proof search that depend on time, such as the limits"
+    " of the lrs saturation algorithm and the point where the time limit is reached, are recorded, together with"
+    " the random seed. Running the same strategy on the same problem with --replay on this file repeats the run,"
+    " so that it can be examined with statistics or profiling turned on. In portfolio modes, every strategy"
+    " records into its own file, named by this value followed by the process id.";
+    _lookup.insert(&_recordReplay);
+    _recordReplay.tag(OptionTag::OUTPUT);
+
+    _replay = StringOptionValue("replay","","off");
+    _replay.description="File recorded with --record_replay, whose decisions are used instead of the ones of this run."
+    " If the recorded run reached the time limit, the replayed one stops at the same point instead, however long"
+    " it takes. Otherwise the time limit applies, so it may need to be raised when the replay runs with"
+    " profiling turned on.";
+    _lookup.insert(&_replay);
+    _replay.tag(OptionTag::OUTPUT);
+    _replay.reliesOn(_recordReplay.is(equal<vstring>("off")));
+
 //*********************** Input  ***********************
 
     _include = StringOptionValue("include","","");
@@ -3055,6 +3122,8 @@ vstring Options::generateEncodedOptions() const
     forbidden.insert(&_randomStrategy);
     forbidden.insert(&_decode);
     forbidden.insert(&_ignoreMissing); // or maybe we do!
+    forbidden.insert(&_recordReplay);
+    forbidden.insert(&_replay);
   }
 
   VirtualIterator<AbstractOptionValue*> options = _lookup.values();
@@ -465,6 +465,12 @@ public:
     NONE = 2
   };
 
+  /** how the time statistics are reported */
+  enum class TimeStatisticsFormat : unsigned int {
+    CSV,
+    TEXT
+  };
+
   /** how much we want vampire talking and in what language */
   enum class Output : unsigned int {
     SMTCOMP,
@@ -2132,6 +2138,15 @@ public:
   RuleActivity generalSplitting() const { return _generalSplitting.actualValue; }
   //vstring namePrefix() const { return _namePrefix.actualValue; }
   bool timeStatistics() const { return _timeStatistics.actualValue; }
+  TimeStatisticsFormat timeStatisticsFormat() const { return _timeStatisticsFormat.actualValue; }
+  vstring saturationTrace() const { return _saturationTrace.actualValue; }
+  unsigned saturationTraceInterval() const { return _saturationTraceInterval.actualValue; }
+  bool allocatorTelemetry() const { return _allocatorTelemetry.actualValue; }
+  vstring statisticsDump() const { return _statisticsDump.actualValue; }
+  vstring sampleProfile() const { return _sampleProfile.actualValue; }
+  unsigned sampleProfileInterval() const { return _sampleProfileInterval.actualValue; }
+  vstring recordReplay() const { return _recordReplay.actualValue; }
+  vstring replay() const { return _replay.actualValue; }
   bool splitting() const { return _splitting.actualValue; }
   void setSplitting(bool value){ _splitting.actualValue=value; }
   bool nonliteralsInClauseWeight() const { return _nonliteralsInClauseWeight.actualValue; }
@@ -2621,6 +2636,15 @@ private:
   /** Time limit in deciseconds */
   TimeLimitOptionValue _timeLimitInDeciseconds;
   BoolOptionValue _timeStatistics;
+  ChoiceOptionValue<TimeStatisticsFormat> _timeStatisticsFormat;
+  StringOptionValue _saturationTrace;
+  UnsignedOptionValue _saturationTraceInterval;
+  BoolOptionValue _allocatorTelemetry;
+  StringOptionValue _statisticsDump;
+  StringOptionValue _sampleProfile;
+  UnsignedOptionValue _sampleProfileInterval;
+  StringOptionValue _recordReplay;
+  StringOptionValue _replay;
 
   ChoiceOptionValue<URResolution> _unitResultingResolution;
   BoolOptionValue _unusedPredicateDefinitionRemoval;
@@ -27,6 +27,8 @@
 #include "Lib/Timer.hpp"
 #include "SAT/Z3Interfacing.hpp"
 
+#include "Kernel/Inference.hpp"
+
 #include "Shell/UIHelper.hpp"
 
 #include "Saturation/SaturationAlgorithm.hpp"
@@ -79,6 +81,7 @@ Statistics::Statistics()
     theoryInstSimpCandidates(0),
     theoryInstSimpTautologies(0),
     theoryInstSimpLostSolution(0),
+    theoryInstSimpSmtCalls(0),
     induction(0),
     maxInductionDepth(0),
     inductionInProof(0),
@@ -100,6 +103,8 @@ Statistics::Statistics()
     condensations(0),
     globalSubsumption(0),
     evaluations(0),
+    evaluationCacheHits(0),
+    evaluationCacheMisses(0),
     interpretedSimplifications(0),
     innerRewrites(0),
     innerRewritesToEqTaut(0),
@@ -136,6 +141,9 @@ Statistics::Statistics()
 
     satSplits(0),
     satSplitRefutations(0),
+    satSplitModelRecomputations(0),
+    satSplitSolverCalls(0),
+    satSplitVarFlips(0),
 
     smtFallbacks(0),
 
@@ -143,20 +151,38 @@ Statistics::Statistics()
     satTWLClauseCount(0),
     satTWLVariablesCount(0),
     satTWLSATCalls(0),
+    satTWLPropagations(0),
+    satTWLBinaryPropagations(0),
+    satTWLSolvingTime(0),
 
     instGenGeneratedClauses(0),
     instGenRedundantClauses(0),
     instGenKeptClauses(0),
     instGenIterations(0),
+    instGenReactivatedClauses(0),
+    instGenRestarts(0),
+    instGenRestartsFromBeginning(0),
+
+    fmbGroundClauses(0),
+    fmbGroundingTime(0),
 
     satPureVarsEliminated(0),
     terminationReason(UNKNOWN),
     refutation(0),
     saturatedSet(0),
-    phase(INITIALIZATION)
+    phase(INITIALIZATION),
+    _inferenceRuleCosts(toNumber(InferenceRule::EXTERNAL_THEORY_AXIOM)+1)
 {
 } // Statistics::Statistics
 
+Statistics::InferenceRuleCost& Statistics::inferenceRuleCost(InferenceRule rule)
+{
+  CALL("Statistics::inferenceRuleCost");
+  ASS_L(toNumber(rule),_inferenceRuleCosts.size());
+
+  return _inferenceRuleCosts[toNumber(rule)];
+}
+
 void Statistics::explainRefutationNotFound(ostream& out)
 {
   // should be a one-liner for each case!
@@ -182,7 +208,15 @@ void Statistics::print(ostream& out)
   if (env.options->statistics()==Options::Statistics::NONE) {
     return;
   }
+  print(out, env.options->statistics()==Options::Statistics::FULL);
+}
 
+/**
+ * Print the statistics, all of them if @b full is true, otherwise only
+ * those shown for -stat brief.
+ */
+void Statistics::print(ostream& out, bool full)
+{
   SaturationAlgorithm::tryUpdateFinalClauseCount();
 
   bool separable=false;
@@ -242,7 +276,7 @@ void Statistics::print(ostream& out)
   }
   out << endl;
 
-  if (env.options->statistics()==Options::Statistics::FULL) {
+  if (full) {
 
   HEADING("Input",inputClauses+inputFormulas);
   COND_OUT("Input clauses", inputClauses);
@@ -298,6 +332,8 @@ void Statistics::print(ostream& out)
   COND_OUT("Condensations", condensations);
   COND_OUT("Global subsumptions", globalSubsumption);
   COND_OUT("Evaluations", evaluations);
+  COND_OUT("Evaluation cache hits", evaluationCacheHits);
+  COND_OUT("Evaluation cache misses", evaluationCacheMisses);
   //COND_OUT("Interpreted simplifications", interpretedSimplifications);
   SEPARATOR;
 
@@ -341,6 +377,7 @@ void Statistics::print(ostream& out)
   COND_OUT("TheoryInstSimpCandidates",theoryInstSimpCandidates);
   COND_OUT("TheoryInstSimpTautologies",theoryInstSimpTautologies);
   COND_OUT("TheoryInstSimpLostSolution",theoryInstSimpLostSolution);
+  COND_OUT("TheoryInstSimpSmtCalls",theoryInstSimpSmtCalls);
   COND_OUT("Induction",induction);
   COND_OUT("MaxInductionDepth",maxInductionDepth);
   COND_OUT("InductionStepsInProof",inductionInProof);
@@ -358,29 +395,38 @@ void Statistics::print(ostream& out)
   COND_OUT("Disequalities generated from acyclicity",taAcyclicityGeneratedDisequalities);
 
   HEADING("AVATAR",splitClauses+splitComponents+uniqueComponents+satSplits+
-        satSplitRefutations);
+        satSplitRefutations+satSplitModelRecomputations);
   COND_OUT("Split clauses", splitClauses);
   COND_OUT("Split components", splitComponents);
   COND_OUT("Unique components", uniqueComponents);
   //COND_OUT("Sat splits", satSplits); // same as split clauses
   COND_OUT("Sat splitting refutations", satSplitRefutations);
+  COND_OUT("Split model recomputations", satSplitModelRecomputations);
+  COND_OUT("Split SAT solver calls", satSplitSolverCalls);
+  COND_OUT("Split variable flips", satSplitVarFlips);
   COND_OUT("SMT fallbacks",smtFallbacks);
   SEPARATOR;
 
   HEADING("Instance Generation",instGenGeneratedClauses+instGenRedundantClauses+
-       instGenKeptClauses+instGenIterations);
+       instGenKeptClauses+instGenIterations+instGenRestarts+instGenRestartsFromBeginning);
   COND_OUT("InstGen generated clauses", instGenGeneratedClauses);
   COND_OUT("InstGen redundant clauses", instGenRedundantClauses);
   COND_OUT("InstGen kept clauses", instGenKeptClauses);
   COND_OUT("InstGen iterations", instGenIterations);
+  COND_OUT("InstGen reactivated clauses", instGenReactivatedClauses);
+  COND_OUT("InstGen restarts", instGenRestarts);
+  COND_OUT("InstGen restarts from beginning", instGenRestartsFromBeginning);
   SEPARATOR;
 
-  //TODO record statistics for FMB
+  HEADING("Finite Model Building",fmbGroundClauses);
+  COND_OUT("FMB ground clauses", fmbGroundClauses);
+  COND_OUT("FMB ground clauses per second", fmbGroundingTime ? fmbGroundClauses*1000/fmbGroundingTime : 0);
+  SEPARATOR;
 
   //TODO record statistics for MiniSAT
   HEADING("SAT Solver Statistics",satTWLClauseCount+satTWLVariablesCount+
         satTWLSATCalls+satClauses+unitSatClauses+binarySatClauses+
-        learntSatClauses+learntSatLiterals+satPureVarsEliminated);
+        learntSatClauses+learntSatLiterals+satPureVarsEliminated+satTWLPropagations);
   COND_OUT("SAT solver clauses", satClauses);
   COND_OUT("SAT solver unit clauses", unitSatClauses);
   COND_OUT("SAT solver binary clauses", binarySatClauses);
@@ -389,6 +435,10 @@ void Statistics::print(ostream& out)
   COND_OUT("TWLsolver clauses", satTWLClauseCount);
   COND_OUT("TWLsolver variables", satTWLVariablesCount);
   COND_OUT("TWLsolver calls for satisfiability", satTWLSATCalls);
+  COND_OUT("TWLsolver propagations", satTWLPropagations);
+  COND_OUT("TWLsolver binary clause propagations", satTWLBinaryPropagations);
+  COND_OUT("TWLsolver propagations per second",
+      satTWLSolvingTime ? (unsigned long)(satTWLPropagations*1e9/satTWLSolvingTime) : 0);
   COND_OUT("Pure propositional variables eliminated by SAT solver", satPureVarsEliminated);
   SEPARATOR;
 
@@ -412,7 +462,64 @@ void Statistics::print(ostream& out)
 
   if (env.options && env.options->timeStatistics()) {
     TimeCounter::printReport(out);
+    printInferenceRuleCosts(out);
+  }
+  Allocator::reportTelemetry(out);
+}
+
+/**
+ * Print a row of the table of inference rule costs unless the rule
+ * has not derived or discarded any clause.
+ */
+static void printInferenceRuleCost(vstring name, const Statistics::InferenceRuleCost& cost, bool csv, ostream& out)
+{
+  CALL("printInferenceRuleCost");
+
+  if (!cost.clauses && !cost.discarded && !cost.time) {
+    return;
+  }
+  addCommentSignForSZS(out);
+  // the memory is only measured with the allocator telemetry
+  bool memory = Allocator::telemetryEnabled();
+  if (csv) {
+    out << name << "," << cost.clauses << "," << cost.retained << "," << cost.discarded
+        << "," << cost.time;
+    if (memory) {
+      out << "," << cost.memory;
+    }
+    out << endl;
+    return;
   }
+  out << name << ": " << cost.clauses << " derived, " << cost.retained << " retained, "
+      << cost.discarded << " discarded, " << (cost.time/1000000) << " ms";
+  if (memory) {
+    out << ", " << cost.memory << " live bytes delta";
+  }
+  out << endl;
+}
+
+void Statistics::printInferenceRuleCosts(ostream& out)
+{
+  CALL("Statistics::printInferenceRuleCosts");
+
+  bool csv = env.options->timeStatisticsFormat()==Options::TimeStatisticsFormat::CSV;
+
+  addCommentSignForSZS(out);
+  out << "Inference rule costs:" << endl;
+  if (csv) {
+    addCommentSignForSZS(out);
+    out << "rule,clauses,retained,discarded,time_ns";
+    if (Allocator::telemetryEnabled()) {
+      out << ",live_bytes_delta";
+    }
+    out << endl;
+  }
+  for (unsigned i=0; i<_inferenceRuleCosts.size(); i++) {
+    printInferenceRuleCost(ruleName(static_cast<InferenceRule>(i)), _inferenceRuleCosts[i], csv, out);
+  }
+  printInferenceRuleCost("forward simplification without conclusion", forwardSimplificationWithoutConclusion, csv, out);
+  printInferenceRuleCost("backward simplification without conclusion", backwardSimplificationWithoutConclusion, csv, out);
+  out << endl;
 }
 
 const char* Statistics::phaseToString(ExecutionPhase p)
@@ -24,6 +24,7 @@
 
 #include "Forwards.hpp"
 
+#include "Lib/DArray.hpp"
 #include "Lib/RCPtr.hpp"
 #include "Lib/ScopedPtr.hpp"
 
@@ -34,6 +35,7 @@ extern const char* VERSION_STRING;
 
 namespace Kernel {
   class Unit;
+  enum class InferenceRule : unsigned char;
 }
 
 namespace Shell {
@@ -54,6 +56,7 @@ public:
   Statistics();
 
   void print(ostream& out);
+  void print(ostream& out, bool full);
   void explainRefutationNotFound(ostream& out);
 
   // Input
@@ -125,6 +128,8 @@ public:
   unsigned theoryInstSimpTautologies;
   /** number of theoryInstSimp solutions lost as we could not represent them **/
   unsigned theoryInstSimpLostSolution;
+  /** number of SMT solver calls made by theoryInstSimp **/
+  unsigned theoryInstSimpSmtCalls;
   /** number of induction applications **/
   unsigned induction;
   unsigned maxInductionDepth;
@@ -165,6 +170,10 @@ public:
   unsigned globalSubsumption;
   /** number of evaluations */
   unsigned evaluations;
+  /** number of subterms whose evaluated form was found in the evaluation cache */
+  unsigned long evaluationCacheHits;
+  /** number of subterms which had to be evaluated */
+  unsigned long evaluationCacheMisses;
   /** number of interpreted simplifications */
   unsigned interpretedSimplifications;
   /** number of (proper) inner rewrites */
@@ -205,6 +214,32 @@ public:
 
   unsigned inferencesBlockedForOrderingAftercheck;
 
+  /**
+   * Cost of the clauses derived by one inference rule during saturation
+   *
+   * Time and memory are only measured with time statistics switched on,
+   * memory moreover only with the allocator telemetry.
+   */
+  struct InferenceRuleCost {
+    InferenceRuleCost() : clauses(0), retained(0), discarded(0), time(0), memory(0) {}
+
+    /** clauses derived by the rule that entered the unprocessed queue */
+    unsigned long clauses;
+    /** derived clauses that made it to the passive container */
+    unsigned long retained;
+    /** derived clauses deleted or replaced before reaching the passive container */
+    unsigned long discarded;
+    /** nanoseconds spent in the inference engines deriving the clauses */
+    long long time;
+    /** net change in live bytes (see Allocator::liveBytes()) while deriving the clauses */
+    long long memory;
+  };
+  InferenceRuleCost& inferenceRuleCost(InferenceRule rule);
+  /** forward simplification attempts that did not derive a clause */
+  InferenceRuleCost forwardSimplificationWithoutConclusion;
+  /** backward simplification attempts that did not derive a clause */
+  InferenceRuleCost backwardSimplificationWithoutConclusion;
+
   bool smtReturnedUnknown;
   bool smtDidNotEvaluate;
 
@@ -234,6 +269,12 @@ public:
 
   unsigned satSplits;
   unsigned satSplitRefutations;
+  /** Number of times AVATAR recomputed its SAT model */
+  unsigned satSplitModelRecomputations;
+  /** Number of calls to the SAT solver made by AVATAR */
+  unsigned satSplitSolverCalls;
+  /** Number of SAT variables whose value changed between consecutive AVATAR models */
+  unsigned satSplitVarFlips;
 
   unsigned smtFallbacks;
 
@@ -241,11 +282,28 @@ public:
   unsigned satTWLClauseCount;
   unsigned satTWLVariablesCount;
   unsigned satTWLSATCalls;
+  /** Number of literals assigned by unit propagation in the default sat solver */
+  unsigned long satTWLPropagations;
+  /** Of those, number of propagations from binary clauses */
+  unsigned long satTWLBinaryPropagations;
+  /** Nanoseconds spent in solve() of the default sat solver, to report the propagation rate */
+  long long satTWLSolvingTime;
 
   unsigned instGenGeneratedClauses;
   unsigned instGenRedundantClauses;
   unsigned instGenKeptClauses;
   unsigned instGenIterations;
+  /** Number of clauses selected again after their selected literal became false in the model */
+  unsigned instGenReactivatedClauses;
+  /** Number of restarts with the current clauses */
+  unsigned instGenRestarts;
+  /** Number of restarts from the input clauses */
+  unsigned instGenRestartsFromBeginning;
+
+  /** Number of ground clauses passed to the SAT solver by finite model building */
+  unsigned long fmbGroundClauses;
+  /** Time spent generating them (in milliseconds) */
+  unsigned fmbGroundingTime;
 
   /** Number of pure variables eliminated by SAT solver */
   unsigned satPureVarsEliminated;
@@ -413,6 +471,10 @@ public:
 
 private:
   static const char* phaseToString(ExecutionPhase p);
+  void printInferenceRuleCosts(ostream& out);
+
+  /** indexed by the number of the InferenceRule */
+  DArray<InferenceRuleCost> _inferenceRuleCosts;
 }; // class Statistics
 
 }
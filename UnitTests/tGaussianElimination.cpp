@@ -166,6 +166,13 @@ TEST_ELIMINATE(test_multiplesteps_2
     , clause({  lt(4, f(1))  })
     )
 
+  // x != f(y) + -f(y) \/ C[x]
+  //                      C[0]
+TEST_ELIMINATE(test_cancel_inverse
+    , clause({  neq(x, add(f(y), minus(f(y)))), lt(x, f(x))  })
+    , clause({  lt(0, f(0))  })
+    )
+
   // x  !=4 \/ x+y != 5 \/ C[x]
   // 5-y!=4             \/ C[5-y]
   //                    \/ C[5]
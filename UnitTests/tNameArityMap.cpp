@@ -0,0 +1,90 @@
+/*
+ * File tNameArityMap.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include "Lib/Int.hpp"
+#include "Lib/NameArityMap.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID nameArityMap
+UT_CREATE;
+
+using namespace std;
+using namespace Lib;
+
+TEST_FUN(nameArityMap_arities)
+{
+  NameArityMap m;
+  m.insert("f", 0, 10);
+  m.insert("f", 1, 11);
+  m.insert("f", 2, 12);
+
+  ASS_EQ(m.get("f", 0), 10);
+  ASS_EQ(m.get("f", 1), 11);
+  ASS_EQ(m.get("f", 2), 12);
+  ASS(!m.find("f", 3));
+
+  unsigned v;
+  ALWAYS(m.find("f", 1, v));
+  ASS_EQ(v, 11);
+}
+
+TEST_FUN(nameArityMap_prefixes)
+{
+  NameArityMap m;
+  m.insert("abc", 1, 1);
+  m.insert("", 1, 2);
+
+  // neither a prefix nor an extension of a stored name is found
+  ASS(!m.find("ab", 1));
+  ASS(!m.find("a", 1));
+  ASS(!m.find("abcd", 1));
+  ASS(m.find("abc", 1));
+  ASS_EQ(m.get("", 1), 2);
+
+  m.insert("ab", 1, 3);
+  ASS_EQ(m.get("ab", 1), 3);
+  ASS_EQ(m.get("abc", 1), 1);
+}
+
+TEST_FUN(nameArityMap_growth)
+{
+  NameArityMap m;
+  unsigned cnt = 10000;
+  for (unsigned i=0; i<cnt; i++) {
+    m.insert("s"+Int::toString(i), i%3, i);
+  }
+  for (unsigned i=0; i<cnt; i++) {
+    vstring name = "s"+Int::toString(i);
+    unsigned v;
+    ALWAYS(m.find(name, i%3, v));
+    ASS_EQ(v, i);
+    ASS(!m.find(name, i%3+1));
+  }
+}
+
+/** get() requires the pair to be in the map, missing pairs are looked up by find() and getPtr() */
+TEST_FUN(nameArityMap_missing)
+{
+  NameArityMap m;
+  ASS(!m.find("f", 0));
+  ASS(!m.getPtr("f", 0));
+
+  m.insert("f", 0, 7);
+  unsigned v = 5;
+  NEVER(m.find("g", 0, v));
+  ASS_EQ(v, 5);
+  ASS(!m.getPtr("g", 0));
+  ASS(!m.getPtr("f", 1));
+  ASS(m.getPtr("f", 0));
+  ASS_EQ(*m.getPtr("f", 0), 7);
+}
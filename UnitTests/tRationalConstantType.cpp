@@ -0,0 +1,109 @@
+/*
+ * File tRationalConstantType.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+
+#include <climits>
+
+#include "Kernel/Theory.hpp"
+
+#include "Test/UnitTesting.hpp"
+
+#define UNIT_ID rationalConstantType
+UT_CREATE;
+
+using namespace std;
+using namespace Lib;
+using namespace Kernel;
+
+typedef RationalConstantType Rat;
+
+/** Check that the canonical form of @b r is @b num/den */
+static void checkRat(const Rat& r, int num, int den)
+{
+  ASS_EQ(r.numerator().toInner(), num);
+  ASS_EQ(r.denominator().toInner(), den);
+}
+
+TEST_FUN(rat_lowest_terms)
+{
+  checkRat(Rat(6,8), 3, 4);
+  checkRat(Rat(-6,8), -3, 4);
+  checkRat(Rat(0,5), 0, 1);
+  checkRat(Rat(1,6)+Rat(1,3), 1, 2);
+  checkRat(Rat(1,4)+Rat(1,4), 1, 2);
+  checkRat(Rat(3,4)-Rat(1,4), 1, 2);
+  checkRat(Rat(2,3)*Rat(3,2), 1, 1);
+  checkRat(Rat(4,9)/Rat(2,3), 2, 3);
+  checkRat(Rat(1,3)-Rat(1,3), 0, 1);
+}
+
+TEST_FUN(rat_negative_denominator)
+{
+  checkRat(Rat(1,-2), -1, 2);
+  checkRat(Rat(-1,-2), 1, 2);
+  checkRat(Rat(4,-6), -2, 3);
+  ASS_EQ(Rat(1,-2), Rat(-1,2));
+  checkRat(Rat(1,1)/Rat(-2,1), -1, 2);
+  checkRat(Rat(-1,3)/Rat(-1,6), 2, 1);
+  checkRat(-Rat(1,2), -1, 2);
+  ASS(Rat(1,-2) < Rat(0,1));
+}
+
+TEST_FUN(rat_intermediate_overflow)
+{
+  // the intermediate products do not fit into int, the results do
+  checkRat(Rat(INT_MAX,2)*Rat(2,INT_MAX), 1, 1);
+  checkRat(Rat(INT_MAX,2)+Rat(INT_MAX,2), INT_MAX, 1);
+  checkRat(Rat(INT_MAX,3)+Rat(INT_MAX,6), INT_MAX, 2);
+  checkRat(Rat(INT_MAX,1)/Rat(INT_MAX,1), 1, 1);
+  checkRat(Rat(INT_MIN,3)*Rat(3,1), INT_MIN, 1);
+  checkRat(Rat(INT_MIN,1)/Rat(-2,1), 1<<30, 1);
+  checkRat(Rat(INT_MAX-1,INT_MAX)-Rat(INT_MAX-1,INT_MAX), 0, 1);
+  ASS(Rat(INT_MAX,INT_MAX-1) < Rat(INT_MAX-1,INT_MAX-2));
+  ASS(Rat(INT_MAX-1,INT_MAX) < Rat(INT_MAX,INT_MAX-1));
+  ASS(Rat(INT_MIN,3) < Rat(INT_MIN+1,3));
+
+  // the results themselves do not fit
+  try {
+    Rat(INT_MAX,1)+Rat(1,1);
+    ASSERTION_VIOLATION;
+  } catch (const MachineArithmeticException&) {
+  }
+  try {
+    Rat(1,INT_MAX)*Rat(1,2);
+    ASSERTION_VIOLATION;
+  } catch (const MachineArithmeticException&) {
+  }
+  try {
+    -Rat(INT_MIN,1);
+    ASSERTION_VIOLATION;
+  } catch (const MachineArithmeticException&) {
+  }
+}
+
+TEST_FUN(rat_div_by_zero)
+{
+  try {
+    Rat(1,0);
+    ASSERTION_VIOLATION;
+  } catch (const DivByZeroException&) {
+  }
+  try {
+    Rat(1,2)/Rat(0,1);
+    ASSERTION_VIOLATION;
+  } catch (const DivByZeroException&) {
+  }
+  try {
+    Rat(0,1)/(Rat(1,3)-Rat(1,3));
+    ASSERTION_VIOLATION;
+  } catch (const DivByZeroException&) {
+  }
+}
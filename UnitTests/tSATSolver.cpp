@@ -15,6 +15,8 @@
 #include "Lib/Stack.hpp"
 #include "Lib/Environment.hpp"
 
+#include "Shell/Statistics.hpp"
+
 #include "SAT/SATClause.hpp"
 #include "SAT/SATLiteral.hpp"
 #include "SAT/SATInference.hpp"
@@ -309,3 +311,55 @@ TEST_FUN(testSolvingUnderAssumptions)
     testAssumptions(sZ3);
   }*/
 }
+
+/**
+ * Binary clauses are propagated through their own watches,
+ * check that they propagate and report conflicts.
+ */
+void testBinaryPropagation(SATSolverWithAssumptions &s)
+{
+  CALL("testBinaryPropagation");
+
+  ensurePrepared(s);
+
+  // a implies b, b implies c, c implies d
+  s.addClause(getClause("aB"));
+  s.addClause(getClause("bC"));
+  s.addClause(getClause("cD"));
+
+  s.addAssumption(getLit('A'));
+  ASS_EQ(s.solve(),SATSolver::SATISFIABLE);
+  ASS(s.trueInAssignment(getLit('B')));
+  ASS(s.trueInAssignment(getLit('C')));
+  ASS(s.trueInAssignment(getLit('D')));
+  s.retractAllAssumptions();
+
+  // a now implies both d and not d
+  s.addClause(getClause("cd"));
+  s.addAssumption(getLit('A'));
+  ASS_EQ(s.solve(),SATSolver::UNSATISFIABLE);
+  s.retractAllAssumptions();
+
+  ASS_EQ(s.solve(),SATSolver::SATISFIABLE);
+  ASS(s.falseInAssignment(getLit('A')));
+
+  // every assignment of e and f falsifies one of these
+  s.addClause(getClause("ef"));
+  s.addClause(getClause("eF"));
+  s.addClause(getClause("Ef"));
+  s.addClause(getClause("EF"));
+  ASS_EQ(s.solve(),SATSolver::UNSATISFIABLE);
+}
+
+TEST_FUN(testBinaryClausePropagation)
+{
+  cout << endl << "Minisat" << endl;
+  MinisatInterfacing sMini(*env.options,true);
+  testBinaryPropagation(sMini);
+
+  cout << endl << "TWL" << endl;
+  DEBUG_CODE(unsigned long binaryPropagations = env.statistics->satTWLBinaryPropagations;)
+  TWLSolver sTWL(*env.options,true);
+  testBinaryPropagation(sTWL);
+  ASS_G(env.statistics->satTWLBinaryPropagations, binaryPropagations);
+}
@@ -0,0 +1,10 @@
+% Group in which every element cubes to the identity: the commutator
+% of a and b commutes with b. Pure equational reasoning, demodulation
+% heavy.
+% params: -sa otter -awr 1:5
+% res: unsat
+cnf(left_identity,axiom, mult(e,X) = X ).
+cnf(left_inverse,axiom, mult(inv(X),X) = e ).
+cnf(associativity,axiom, mult(mult(X,Y),Z) = mult(X,mult(Y,Z)) ).
+cnf(cube_is_identity,axiom, mult(X,mult(X,X)) = e ).
+cnf(prove_commutator,negated_conjecture, mult(mult(mult(inv(a),inv(b)),mult(a,b)),b) != mult(b,mult(mult(inv(a),inv(b)),mult(a,b))) ).
@@ -0,0 +1,10 @@
+; Value of a recursively defined sum of integers. Every unfolding of the
+; definition needs its guard evaluated by the arithmetic simplifications.
+; params: --input_syntax smtlib2 -sa discount
+; res: unsat
+(set-logic UFLIA)
+(declare-fun s (Int) Int)
+(assert (= (s 0) 0))
+(assert (forall ((x Int)) (=> (> x 0) (= (s x) (+ (s (- x 1)) x)))))
+(assert (not (= (s 20) 210)))
+(check-sat)
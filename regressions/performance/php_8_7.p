@@ -0,0 +1,208 @@
+% Pigeonhole principle, 8 pigeons and 7 holes, without AVATAR.
+% Stresses resolution, factoring and subsumption on ground clauses.
+% params: -sa otter -av off
+% res: unsat
+cnf(pigeon_0,axiom, in(p0,h0) | in(p0,h1) | in(p0,h2) | in(p0,h3) | in(p0,h4) | in(p0,h5) | in(p0,h6) ).
+cnf(pigeon_1,axiom, in(p1,h0) | in(p1,h1) | in(p1,h2) | in(p1,h3) | in(p1,h4) | in(p1,h5) | in(p1,h6) ).
+cnf(pigeon_2,axiom, in(p2,h0) | in(p2,h1) | in(p2,h2) | in(p2,h3) | in(p2,h4) | in(p2,h5) | in(p2,h6) ).
+cnf(pigeon_3,axiom, in(p3,h0) | in(p3,h1) | in(p3,h2) | in(p3,h3) | in(p3,h4) | in(p3,h5) | in(p3,h6) ).
+cnf(pigeon_4,axiom, in(p4,h0) | in(p4,h1) | in(p4,h2) | in(p4,h3) | in(p4,h4) | in(p4,h5) | in(p4,h6) ).
+cnf(pigeon_5,axiom, in(p5,h0) | in(p5,h1) | in(p5,h2) | in(p5,h3) | in(p5,h4) | in(p5,h5) | in(p5,h6) ).
+cnf(pigeon_6,axiom, in(p6,h0) | in(p6,h1) | in(p6,h2) | in(p6,h3) | in(p6,h4) | in(p6,h5) | in(p6,h6) ).
+cnf(pigeon_7,axiom, in(p7,h0) | in(p7,h1) | in(p7,h2) | in(p7,h3) | in(p7,h4) | in(p7,h5) | in(p7,h6) ).
+cnf(hole_0_0_1,axiom, ~in(p0,h0) | ~in(p1,h0) ).
+cnf(hole_0_0_2,axiom, ~in(p0,h0) | ~in(p2,h0) ).
+cnf(hole_0_0_3,axiom, ~in(p0,h0) | ~in(p3,h0) ).
+cnf(hole_0_0_4,axiom, ~in(p0,h0) | ~in(p4,h0) ).
+cnf(hole_0_0_5,axiom, ~in(p0,h0) | ~in(p5,h0) ).
+cnf(hole_0_0_6,axiom, ~in(p0,h0) | ~in(p6,h0) ).
+cnf(hole_0_0_7,axiom, ~in(p0,h0) | ~in(p7,h0) ).
+cnf(hole_0_1_2,axiom, ~in(p1,h0) | ~in(p2,h0) ).
+cnf(hole_0_1_3,axiom, ~in(p1,h0) | ~in(p3,h0) ).
+cnf(hole_0_1_4,axiom, ~in(p1,h0) | ~in(p4,h0) ).
+cnf(hole_0_1_5,axiom, ~in(p1,h0) | ~in(p5,h0) ).
+cnf(hole_0_1_6,axiom, ~in(p1,h0) | ~in(p6,h0) ).
+cnf(hole_0_1_7,axiom, ~in(p1,h0) | ~in(p7,h0) ).
+cnf(hole_0_2_3,axiom, ~in(p2,h0) | ~in(p3,h0) ).
+cnf(hole_0_2_4,axiom, ~in(p2,h0) | ~in(p4,h0) ).
+cnf(hole_0_2_5,axiom, ~in(p2,h0) | ~in(p5,h0) ).
+cnf(hole_0_2_6,axiom, ~in(p2,h0) | ~in(p6,h0) ).
+cnf(hole_0_2_7,axiom, ~in(p2,h0) | ~in(p7,h0) ).
+cnf(hole_0_3_4,axiom, ~in(p3,h0) | ~in(p4,h0) ).
+cnf(hole_0_3_5,axiom, ~in(p3,h0) | ~in(p5,h0) ).
+cnf(hole_0_3_6,axiom, ~in(p3,h0) | ~in(p6,h0) ).
+cnf(hole_0_3_7,axiom, ~in(p3,h0) | ~in(p7,h0) ).
+cnf(hole_0_4_5,axiom, ~in(p4,h0) | ~in(p5,h0) ).
+cnf(hole_0_4_6,axiom, ~in(p4,h0) | ~in(p6,h0) ).
+cnf(hole_0_4_7,axiom, ~in(p4,h0) | ~in(p7,h0) ).
+cnf(hole_0_5_6,axiom, ~in(p5,h0) | ~in(p6,h0) ).
+cnf(hole_0_5_7,axiom, ~in(p5,h0) | ~in(p7,h0) ).
+cnf(hole_0_6_7,axiom, ~in(p6,h0) | ~in(p7,h0) ).
+cnf(hole_1_0_1,axiom, ~in(p0,h1) | ~in(p1,h1) ).
+cnf(hole_1_0_2,axiom, ~in(p0,h1) | ~in(p2,h1) ).
+cnf(hole_1_0_3,axiom, ~in(p0,h1) | ~in(p3,h1) ).
+cnf(hole_1_0_4,axiom, ~in(p0,h1) | ~in(p4,h1) ).
+cnf(hole_1_0_5,axiom, ~in(p0,h1) | ~in(p5,h1) ).
+cnf(hole_1_0_6,axiom, ~in(p0,h1) | ~in(p6,h1) ).
+cnf(hole_1_0_7,axiom, ~in(p0,h1) | ~in(p7,h1) ).
+cnf(hole_1_1_2,axiom, ~in(p1,h1) | ~in(p2,h1) ).
+cnf(hole_1_1_3,axiom, ~in(p1,h1) | ~in(p3,h1) ).
+cnf(hole_1_1_4,axiom, ~in(p1,h1) | ~in(p4,h1) ).
+cnf(hole_1_1_5,axiom, ~in(p1,h1) | ~in(p5,h1) ).
+cnf(hole_1_1_6,axiom, ~in(p1,h1) | ~in(p6,h1) ).
+cnf(hole_1_1_7,axiom, ~in(p1,h1) | ~in(p7,h1) ).
+cnf(hole_1_2_3,axiom, ~in(p2,h1) | ~in(p3,h1) ).
+cnf(hole_1_2_4,axiom, ~in(p2,h1) | ~in(p4,h1) ).
+cnf(hole_1_2_5,axiom, ~in(p2,h1) | ~in(p5,h1) ).
+cnf(hole_1_2_6,axiom, ~in(p2,h1) | ~in(p6,h1) ).
+cnf(hole_1_2_7,axiom, ~in(p2,h1) | ~in(p7,h1) ).
+cnf(hole_1_3_4,axiom, ~in(p3,h1) | ~in(p4,h1) ).
+cnf(hole_1_3_5,axiom, ~in(p3,h1) | ~in(p5,h1) ).
+cnf(hole_1_3_6,axiom, ~in(p3,h1) | ~in(p6,h1) ).
+cnf(hole_1_3_7,axiom, ~in(p3,h1) | ~in(p7,h1) ).
+cnf(hole_1_4_5,axiom, ~in(p4,h1) | ~in(p5,h1) ).
+cnf(hole_1_4_6,axiom, ~in(p4,h1) | ~in(p6,h1) ).
+cnf(hole_1_4_7,axiom, ~in(p4,h1) | ~in(p7,h1) ).
+cnf(hole_1_5_6,axiom, ~in(p5,h1) | ~in(p6,h1) ).
+cnf(hole_1_5_7,axiom, ~in(p5,h1) | ~in(p7,h1) ).
+cnf(hole_1_6_7,axiom, ~in(p6,h1) | ~in(p7,h1) ).
+cnf(hole_2_0_1,axiom, ~in(p0,h2) | ~in(p1,h2) ).
+cnf(hole_2_0_2,axiom, ~in(p0,h2) | ~in(p2,h2) ).
+cnf(hole_2_0_3,axiom, ~in(p0,h2) | ~in(p3,h2) ).
+cnf(hole_2_0_4,axiom, ~in(p0,h2) | ~in(p4,h2) ).
+cnf(hole_2_0_5,axiom, ~in(p0,h2) | ~in(p5,h2) ).
+cnf(hole_2_0_6,axiom, ~in(p0,h2) | ~in(p6,h2) ).
+cnf(hole_2_0_7,axiom, ~in(p0,h2) | ~in(p7,h2) ).
+cnf(hole_2_1_2,axiom, ~in(p1,h2) | ~in(p2,h2) ).
+cnf(hole_2_1_3,axiom, ~in(p1,h2) | ~in(p3,h2) ).
+cnf(hole_2_1_4,axiom, ~in(p1,h2) | ~in(p4,h2) ).
+cnf(hole_2_1_5,axiom, ~in(p1,h2) | ~in(p5,h2) ).
+cnf(hole_2_1_6,axiom, ~in(p1,h2) | ~in(p6,h2) ).
+cnf(hole_2_1_7,axiom, ~in(p1,h2) | ~in(p7,h2) ).
+cnf(hole_2_2_3,axiom, ~in(p2,h2) | ~in(p3,h2) ).
+cnf(hole_2_2_4,axiom, ~in(p2,h2) | ~in(p4,h2) ).
+cnf(hole_2_2_5,axiom, ~in(p2,h2) | ~in(p5,h2) ).
+cnf(hole_2_2_6,axiom, ~in(p2,h2) | ~in(p6,h2) ).
+cnf(hole_2_2_7,axiom, ~in(p2,h2) | ~in(p7,h2) ).
+cnf(hole_2_3_4,axiom, ~in(p3,h2) | ~in(p4,h2) ).
+cnf(hole_2_3_5,axiom, ~in(p3,h2) | ~in(p5,h2) ).
+cnf(hole_2_3_6,axiom, ~in(p3,h2) | ~in(p6,h2) ).
+cnf(hole_2_3_7,axiom, ~in(p3,h2) | ~in(p7,h2) ).
+cnf(hole_2_4_5,axiom, ~in(p4,h2) | ~in(p5,h2) ).
+cnf(hole_2_4_6,axiom, ~in(p4,h2) | ~in(p6,h2) ).
+cnf(hole_2_4_7,axiom, ~in(p4,h2) | ~in(p7,h2) ).
+cnf(hole_2_5_6,axiom, ~in(p5,h2) | ~in(p6,h2) ).
+cnf(hole_2_5_7,axiom, ~in(p5,h2) | ~in(p7,h2) ).
+cnf(hole_2_6_7,axiom, ~in(p6,h2) | ~in(p7,h2) ).
+cnf(hole_3_0_1,axiom, ~in(p0,h3) | ~in(p1,h3) ).
+cnf(hole_3_0_2,axiom, ~in(p0,h3) | ~in(p2,h3) ).
+cnf(hole_3_0_3,axiom, ~in(p0,h3) | ~in(p3,h3) ).
+cnf(hole_3_0_4,axiom, ~in(p0,h3) | ~in(p4,h3) ).
+cnf(hole_3_0_5,axiom, ~in(p0,h3) | ~in(p5,h3) ).
+cnf(hole_3_0_6,axiom, ~in(p0,h3) | ~in(p6,h3) ).
+cnf(hole_3_0_7,axiom, ~in(p0,h3) | ~in(p7,h3) ).
+cnf(hole_3_1_2,axiom, ~in(p1,h3) | ~in(p2,h3) ).
+cnf(hole_3_1_3,axiom, ~in(p1,h3) | ~in(p3,h3) ).
+cnf(hole_3_1_4,axiom, ~in(p1,h3) | ~in(p4,h3) ).
+cnf(hole_3_1_5,axiom, ~in(p1,h3) | ~in(p5,h3) ).
+cnf(hole_3_1_6,axiom, ~in(p1,h3) | ~in(p6,h3) ).
+cnf(hole_3_1_7,axiom, ~in(p1,h3) | ~in(p7,h3) ).
+cnf(hole_3_2_3,axiom, ~in(p2,h3) | ~in(p3,h3) ).
+cnf(hole_3_2_4,axiom, ~in(p2,h3) | ~in(p4,h3) ).
+cnf(hole_3_2_5,axiom, ~in(p2,h3) | ~in(p5,h3) ).
+cnf(hole_3_2_6,axiom, ~in(p2,h3) | ~in(p6,h3) ).
+cnf(hole_3_2_7,axiom, ~in(p2,h3) | ~in(p7,h3) ).
+cnf(hole_3_3_4,axiom, ~in(p3,h3) | ~in(p4,h3) ).
+cnf(hole_3_3_5,axiom, ~in(p3,h3) | ~in(p5,h3) ).
+cnf(hole_3_3_6,axiom, ~in(p3,h3) | ~in(p6,h3) ).
+cnf(hole_3_3_7,axiom, ~in(p3,h3) | ~in(p7,h3) ).
+cnf(hole_3_4_5,axiom, ~in(p4,h3) | ~in(p5,h3) ).
+cnf(hole_3_4_6,axiom, ~in(p4,h3) | ~in(p6,h3) ).
+cnf(hole_3_4_7,axiom, ~in(p4,h3) | ~in(p7,h3) ).
+cnf(hole_3_5_6,axiom, ~in(p5,h3) | ~in(p6,h3) ).
+cnf(hole_3_5_7,axiom, ~in(p5,h3) | ~in(p7,h3) ).
+cnf(hole_3_6_7,axiom, ~in(p6,h3) | ~in(p7,h3) ).
+cnf(hole_4_0_1,axiom, ~in(p0,h4) | ~in(p1,h4) ).
+cnf(hole_4_0_2,axiom, ~in(p0,h4) | ~in(p2,h4) ).
+cnf(hole_4_0_3,axiom, ~in(p0,h4) | ~in(p3,h4) ).
+cnf(hole_4_0_4,axiom, ~in(p0,h4) | ~in(p4,h4) ).
+cnf(hole_4_0_5,axiom, ~in(p0,h4) | ~in(p5,h4) ).
+cnf(hole_4_0_6,axiom, ~in(p0,h4) | ~in(p6,h4) ).
+cnf(hole_4_0_7,axiom, ~in(p0,h4) | ~in(p7,h4) ).
+cnf(hole_4_1_2,axiom, ~in(p1,h4) | ~in(p2,h4) ).
+cnf(hole_4_1_3,axiom, ~in(p1,h4) | ~in(p3,h4) ).
+cnf(hole_4_1_4,axiom, ~in(p1,h4) | ~in(p4,h4) ).
+cnf(hole_4_1_5,axiom, ~in(p1,h4) | ~in(p5,h4) ).
+cnf(hole_4_1_6,axiom, ~in(p1,h4) | ~in(p6,h4) ).
+cnf(hole_4_1_7,axiom, ~in(p1,h4) | ~in(p7,h4) ).
+cnf(hole_4_2_3,axiom, ~in(p2,h4) | ~in(p3,h4) ).
+cnf(hole_4_2_4,axiom, ~in(p2,h4) | ~in(p4,h4) ).
+cnf(hole_4_2_5,axiom, ~in(p2,h4) | ~in(p5,h4) ).
+cnf(hole_4_2_6,axiom, ~in(p2,h4) | ~in(p6,h4) ).
+cnf(hole_4_2_7,axiom, ~in(p2,h4) | ~in(p7,h4) ).
+cnf(hole_4_3_4,axiom, ~in(p3,h4) | ~in(p4,h4) ).
+cnf(hole_4_3_5,axiom, ~in(p3,h4) | ~in(p5,h4) ).
+cnf(hole_4_3_6,axiom, ~in(p3,h4) | ~in(p6,h4) ).
+cnf(hole_4_3_7,axiom, ~in(p3,h4) | ~in(p7,h4) ).
+cnf(hole_4_4_5,axiom, ~in(p4,h4) | ~in(p5,h4) ).
+cnf(hole_4_4_6,axiom, ~in(p4,h4) | ~in(p6,h4) ).
+cnf(hole_4_4_7,axiom, ~in(p4,h4) | ~in(p7,h4) ).
+cnf(hole_4_5_6,axiom, ~in(p5,h4) | ~in(p6,h4) ).
+cnf(hole_4_5_7,axiom, ~in(p5,h4) | ~in(p7,h4) ).
+cnf(hole_4_6_7,axiom, ~in(p6,h4) | ~in(p7,h4) ).
+cnf(hole_5_0_1,axiom, ~in(p0,h5) | ~in(p1,h5) ).
+cnf(hole_5_0_2,axiom, ~in(p0,h5) | ~in(p2,h5) ).
+cnf(hole_5_0_3,axiom, ~in(p0,h5) | ~in(p3,h5) ).
+cnf(hole_5_0_4,axiom, ~in(p0,h5) | ~in(p4,h5) ).
+cnf(hole_5_0_5,axiom, ~in(p0,h5) | ~in(p5,h5) ).
+cnf(hole_5_0_6,axiom, ~in(p0,h5) | ~in(p6,h5) ).
+cnf(hole_5_0_7,axiom, ~in(p0,h5) | ~in(p7,h5) ).
+cnf(hole_5_1_2,axiom, ~in(p1,h5) | ~in(p2,h5) ).
+cnf(hole_5_1_3,axiom, ~in(p1,h5) | ~in(p3,h5) ).
+cnf(hole_5_1_4,axiom, ~in(p1,h5) | ~in(p4,h5) ).
+cnf(hole_5_1_5,axiom, ~in(p1,h5) | ~in(p5,h5) ).
+cnf(hole_5_1_6,axiom, ~in(p1,h5) | ~in(p6,h5) ).
+cnf(hole_5_1_7,axiom, ~in(p1,h5) | ~in(p7,h5) ).
+cnf(hole_5_2_3,axiom, ~in(p2,h5) | ~in(p3,h5) ).
+cnf(hole_5_2_4,axiom, ~in(p2,h5) | ~in(p4,h5) ).
+cnf(hole_5_2_5,axiom, ~in(p2,h5) | ~in(p5,h5) ).
+cnf(hole_5_2_6,axiom, ~in(p2,h5) | ~in(p6,h5) ).
+cnf(hole_5_2_7,axiom, ~in(p2,h5) | ~in(p7,h5) ).
+cnf(hole_5_3_4,axiom, ~in(p3,h5) | ~in(p4,h5) ).
+cnf(hole_5_3_5,axiom, ~in(p3,h5) | ~in(p5,h5) ).
+cnf(hole_5_3_6,axiom, ~in(p3,h5) | ~in(p6,h5) ).
+cnf(hole_5_3_7,axiom, ~in(p3,h5) | ~in(p7,h5) ).
+cnf(hole_5_4_5,axiom, ~in(p4,h5) | ~in(p5,h5) ).
+cnf(hole_5_4_6,axiom, ~in(p4,h5) | ~in(p6,h5) ).
+cnf(hole_5_4_7,axiom, ~in(p4,h5) | ~in(p7,h5) ).
+cnf(hole_5_5_6,axiom, ~in(p5,h5) | ~in(p6,h5) ).
+cnf(hole_5_5_7,axiom, ~in(p5,h5) | ~in(p7,h5) ).
+cnf(hole_5_6_7,axiom, ~in(p6,h5) | ~in(p7,h5) ).
+cnf(hole_6_0_1,axiom, ~in(p0,h6) | ~in(p1,h6) ).
+cnf(hole_6_0_2,axiom, ~in(p0,h6) | ~in(p2,h6) ).
+cnf(hole_6_0_3,axiom, ~in(p0,h6) | ~in(p3,h6) ).
+cnf(hole_6_0_4,axiom, ~in(p0,h6) | ~in(p4,h6) ).
+cnf(hole_6_0_5,axiom, ~in(p0,h6) | ~in(p5,h6) ).
+cnf(hole_6_0_6,axiom, ~in(p0,h6) | ~in(p6,h6) ).
+cnf(hole_6_0_7,axiom, ~in(p0,h6) | ~in(p7,h6) ).
+cnf(hole_6_1_2,axiom, ~in(p1,h6) | ~in(p2,h6) ).
+cnf(hole_6_1_3,axiom, ~in(p1,h6) | ~in(p3,h6) ).
+cnf(hole_6_1_4,axiom, ~in(p1,h6) | ~in(p4,h6) ).
+cnf(hole_6_1_5,axiom, ~in(p1,h6) | ~in(p5,h6) ).
+cnf(hole_6_1_6,axiom, ~in(p1,h6) | ~in(p6,h6) ).
+cnf(hole_6_1_7,axiom, ~in(p1,h6) | ~in(p7,h6) ).
+cnf(hole_6_2_3,axiom, ~in(p2,h6) | ~in(p3,h6) ).
+cnf(hole_6_2_4,axiom, ~in(p2,h6) | ~in(p4,h6) ).
+cnf(hole_6_2_5,axiom, ~in(p2,h6) | ~in(p5,h6) ).
+cnf(hole_6_2_6,axiom, ~in(p2,h6) | ~in(p6,h6) ).
+cnf(hole_6_2_7,axiom, ~in(p2,h6) | ~in(p7,h6) ).
+cnf(hole_6_3_4,axiom, ~in(p3,h6) | ~in(p4,h6) ).
+cnf(hole_6_3_5,axiom, ~in(p3,h6) | ~in(p5,h6) ).
+cnf(hole_6_3_6,axiom, ~in(p3,h6) | ~in(p6,h6) ).
+cnf(hole_6_3_7,axiom, ~in(p3,h6) | ~in(p7,h6) ).
+cnf(hole_6_4_5,axiom, ~in(p4,h6) | ~in(p5,h6) ).
+cnf(hole_6_4_6,axiom, ~in(p4,h6) | ~in(p6,h6) ).
+cnf(hole_6_4_7,axiom, ~in(p4,h6) | ~in(p7,h6) ).
+cnf(hole_6_5_6,axiom, ~in(p5,h6) | ~in(p6,h6) ).
+cnf(hole_6_5_7,axiom, ~in(p5,h6) | ~in(p7,h6) ).
+cnf(hole_6_6_7,axiom, ~in(p6,h6) | ~in(p7,h6) ).
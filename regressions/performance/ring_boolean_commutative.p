@@ -0,0 +1,13 @@
+% Boolean rings are commutative. Superposition with a large number of
+% rewrites of the distributivity axioms.
+% params: -sa discount -awr 1:1
+% res: unsat
+cnf(add_assoc,axiom, add(add(X,Y),Z) = add(X,add(Y,Z)) ).
+cnf(add_comm,axiom, add(X,Y) = add(Y,X) ).
+cnf(add_zero,axiom, add(zero,X) = X ).
+cnf(add_inv,axiom, add(neg(X),X) = zero ).
+cnf(mul_assoc,axiom, mul(mul(X,Y),Z) = mul(X,mul(Y,Z)) ).
+cnf(distr1,axiom, mul(X,add(Y,Z)) = add(mul(X,Y),mul(X,Z)) ).
+cnf(distr2,axiom, mul(add(X,Y),Z) = add(mul(X,Z),mul(Y,Z)) ).
+cnf(boolean,axiom, mul(X,X) = X ).
+cnf(prove_comm,negated_conjecture, mul(a,b) != mul(b,a) ).
@@ -0,0 +1,200 @@
+#!/bin/bash
+
+usage()
+{
+cat <<EOF
+Usage:
+ run_performance.sh [-u] [-r {runs}] {vampire executable} [{baseline file}]
+
+Runs Vampire on every problem in regressions/performance and compares
+the measured time, memory, number of activations (given clause loop
+iterations) and number of generated clauses with a baseline, by default
+regressions/performance/baseline.tsv.
+
+Problem files may contain tags in format
+ "% {tag name}: {tag value}" (or "; {tag name}: {tag value}" in SMT-LIB)
+
+Supported tags in problem files
+ params -- arguments to be passed to the vampire executable in addition
+           to the fixed "$FIXED_PARAMS"
+ res -- either sat or unsat, asserts expected result
+
+Options
+ -u -- store the measured values as the new baseline instead of comparing,
+       times are left out when storing the default baseline
+ -r -- run each problem this many times and take the fastest run
+       (default $RUNS)
+
+A value is a regression if it exceeds the baseline by more than the
+tolerance given by the environment variables (defaults in parentheses)
+ TIME_TOLERANCE ($TIME_TOLERANCE) and TIME_SLACK_MS ($TIME_SLACK_MS) --
+           time must be at most baseline*TIME_TOLERANCE+TIME_SLACK_MS
+ MEMORY_TOLERANCE ($MEMORY_TOLERANCE)
+ COUNT_TOLERANCE ($COUNT_TOLERANCE) -- for activations and generated clauses
+
+Times are only comparable with a baseline recorded on the same machine,
+so the committed baseline has no times ("-") and times are not compared
+against it. To check times, store a local baseline first and compare
+with it:
+ run_performance.sh -u {vampire executable} {local baseline file}
+ run_performance.sh {vampire executable} {local baseline file}
+
+Meaning of exit statuses
+ 0 -- no regression
+ 1 -- some value regressed or vampire gave a wrong result
+ 2 -- invalid format of problem file or missing baseline
+ 3 -- invalid usage
+EOF
+}
+
+TEST_DIR=`dirname $0`
+PRB_DIR="$TEST_DIR/performance"
+
+FIXED_PARAMS="--random_seed 1 -t 60 -stat full"
+RUNS=3
+TIME_TOLERANCE=${TIME_TOLERANCE:-1.25}
+TIME_SLACK_MS=${TIME_SLACK_MS:-50}
+MEMORY_TOLERANCE=${MEMORY_TOLERANCE:-1.2}
+COUNT_TOLERANCE=${COUNT_TOLERANCE:-1.1}
+
+UPDATE=0
+while getopts "ur:" OPT; do
+        case $OPT in
+        u) UPDATE=1 ;;
+        r) RUNS=$OPTARG ;;
+        *) usage; exit 3 ;;
+        esac
+done
+shift $((OPTIND-1))
+
+if [ $# -lt 1 -o $# -gt 2 ]; then
+        echo "Invalid number of arguments"
+        usage
+        exit 3
+fi
+
+VEXEC=$1
+DEFAULT_BASELINE=$PRB_DIR/baseline.tsv
+BASELINE=${2:-$DEFAULT_BASELINE}
+
+function get_unique_tag_value()
+{
+        #Arguments: {tag name} {target variable name}
+        #if tag is not present, empty string is assigned to the target variable name
+        local TAG=$1
+        local TGT=$2
+        local PATTERN="^[%;] $TAG: \(.*\)$"
+        if [ `grep "$PATTERN" $PRB | wc -l` -gt 1 ]; then
+                echo "Error in $PRB: Only one $TAG tag alowed"
+                exit 2
+        fi
+        local VAL="`grep \"$PATTERN\" $PRB | sed \"s/$PATTERN/\1/\"`"
+        eval $TGT="\"$VAL\""
+}
+
+function get_statistic()
+{
+        #Arguments: {statistic name}
+        #statistics with zero value are not printed by vampire
+        local VAL="`grep -a \"^% $1: \" $OUTF | sed \"s/^% $1: \([0-9.]*\).*$/\1/\"`"
+        echo ${VAL:-0}
+}
+
+OUTF=`mktemp -t rpfXXXXXX`
+RESF=`mktemp -t rpfXXXXXX`
+trap "rm -f $OUTF $RESF" EXIT
+
+echo -e "problem\ttime_ms\tmemory_kb\tactivations\tgenerated" > $RESF
+
+for PRB in $PRB_DIR/*.p $PRB_DIR/*.smt2; do
+        [ -f "$PRB" ] || continue
+        get_unique_tag_value params PARAMS
+        get_unique_tag_value res RES
+
+        BEST_MS=""
+        for ((RUN=0; RUN<RUNS; RUN++)); do
+                $VEXEC $FIXED_PARAMS $PARAMS $PRB > $OUTF 2>&1
+                STATUS=$?
+                if [ "$STATUS" -gt 1 ]; then
+                        cat $OUTF
+                        echo
+                        echo "Vampire exitted with error status $STATUS on $PRB"
+                        exit 1
+                fi
+                case "$RES" in
+                "") ;;
+                "sat")
+                        if ! grep -a -q "Satisfiable!" $OUTF; then
+                                echo "Vampire did not show satisfiability on $PRB"
+                                exit 1
+                        fi
+                        ;;
+                "unsat")
+                        if ! grep -a -q "Refutation found. Thanks to Tanya!" $OUTF; then
+                                echo "Vampire did not prove unsatisfiability on $PRB"
+                                exit 1
+                        fi
+                        ;;
+                *)
+                        echo "Error in $PRB: Unrecognized res tag value: $RES"
+                        exit 2
+                        ;;
+                esac
+                MS=`get_statistic "Time elapsed" | awk '{ printf "%d", $1*1000 + 0.5 }'`
+                if [ -z "$BEST_MS" ] || [ $MS -lt $BEST_MS ]; then
+                        BEST_MS=$MS
+                fi
+        done
+        # the remaining values do not depend on the run thanks to the fixed seed
+        echo -e "`basename $PRB`\t$BEST_MS\t`get_statistic 'Memory used \[KB\]'`\t`get_statistic 'Active clauses'`\t`get_statistic 'Generated clauses'`" >> $RESF
+done
+
+if [ $UPDATE -eq 1 ]; then
+        if [ "$BASELINE" = "$DEFAULT_BASELINE" ]; then
+                # times of this machine mean nothing elsewhere
+                awk -F '\t' -v OFS='\t' 'FNR>1 { $2 = "-" } 1' $RESF > $BASELINE
+        else
+                cp $RESF $BASELINE
+        fi
+        cat $RESF
+        echo "# baseline stored in $BASELINE"
+        exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+        cat $RESF
+        echo "# baseline $BASELINE does not exist, create it with -u"
+        exit 2
+fi
+
+awk -F '\t' -v tt=$TIME_TOLERANCE -v ts=$TIME_SLACK_MS -v mt=$MEMORY_TOLERANCE -v ct=$COUNT_TOLERANCE '
+FNR==1 { next }
+NR==FNR { for (i=2; i<=NF; i++) base[$1,i] = $i; known[$1] = 1; next }
+{
+  if (!($1 in known)) {
+    printf "%-32s not in the baseline\n", $1
+    next
+  }
+  line = sprintf("%-32s", $1)
+  for (i=2; i<=NF; i++) {
+    b = base[$1,i]
+    if (b == "-") {
+      line = line sprintf("  %s %s", names[i], $i)
+      continue
+    }
+    if (i==2) { limit = b*tt + ts } else if (i==3) { limit = b*mt } else { limit = b*ct }
+    mark = ""
+    if ($i > limit) { mark = " REGRESSION"; failed = 1 }
+    line = line sprintf("  %s %s -> %s%s", names[i], b, $i, mark)
+  }
+  print line
+}
+BEGIN { names[2] = "time_ms"; names[3] = "memory_kb"; names[4] = "activations"; names[5] = "generated" }
+END { exit failed }
+' $BASELINE $RESF
+STATUS=$?
+
+if [ $STATUS -ne 0 ]; then
+        echo "# performance regressions found"
+        exit 1
+fi
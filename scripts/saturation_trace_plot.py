@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""
+Plots a trace of the given clause loop written by vampire with the option
+--saturation_trace <file> (one sample every --saturation_trace_interval
+iterations).
+
+Command line:
+[-d] [-o output.png] [-f field1,field2,...] trace_file
+
+Plots the selected fields (by default all fields except the step and the
+fields which are zero in every sample) against the elapsed time, one graph
+per field, using gnuplot. With -o the plot goes to a png file instead of
+the screen.
+
+"-d" prints the decoded samples as tab separated columns instead of
+plotting them, which is handy for other tools.
+"""
+
+import struct
+import subprocess
+import sys
+import tempfile
+
+def readTrace(fname):
+    """return the list of field names and the list of samples (tuples of ints)"""
+    with open(fname, "rb") as f:
+        data = f.read()
+    if data[0:4] != b"VSTR":
+        sys.exit(fname+" is not a saturation trace")
+    version, fieldCnt = struct.unpack_from("<II", data, 4)
+    if version != 1:
+        sys.exit("unsupported saturation trace version "+str(version))
+    pos = 12
+    fields = []
+    for _ in range(fieldCnt):
+        end = data.index(b"\0", pos)
+        fields.append(data[pos:end].decode("ascii"))
+        pos = end+1
+    sampleFmt = "<"+str(fieldCnt)+"Q"
+    sampleSize = struct.calcsize(sampleFmt)
+    samples = []
+    # a run killed during writing may leave an incomplete last sample
+    while pos+sampleSize <= len(data):
+        samples.append(struct.unpack_from(sampleFmt, data, pos))
+        pos += sampleSize
+    return fields, samples
+
+def main(args):
+    dump = False
+    outFile = None
+    selected = None
+    while len(args) > 1:
+        if args[0] == "-d":
+            dump = True
+            args = args[1:]
+        elif args[0] == "-o":
+            outFile = args[1]
+            args = args[2:]
+        elif args[0] == "-f":
+            selected = args[1].split(",")
+            args = args[2:]
+        else:
+            break
+    if len(args) != 1:
+        sys.exit(__doc__)
+
+    fields, samples = readTrace(args[0])
+
+    if dump:
+        print("\t".join(fields))
+        for s in samples:
+            print("\t".join(map(str, s)))
+        return
+
+    if selected is None:
+        selected = [f for i, f in enumerate(fields)
+                    if f not in ("step", "time_ns") and any(s[i] for s in samples)]
+    for f in selected:
+        if f not in fields:
+            sys.exit("unknown field "+f+", the trace has: "+", ".join(fields))
+    if not samples or not selected:
+        sys.exit("nothing to plot")
+
+    dataFile = tempfile.NamedTemporaryFile(mode="w", suffix=".dat")
+    for s in samples:
+        dataFile.write(" ".join(map(str, s))+"\n")
+    dataFile.flush()
+
+    timeCol = fields.index("time_ns")+1
+    cmds = []
+    if outFile:
+        cmds.append("set terminal png size 1000,"+str(250*len(selected)))
+        cmds.append("set output \""+outFile+"\"")
+    cmds.append("set multiplot layout "+str(len(selected))+",1")
+    cmds.append("set xlabel \"seconds\"")
+    for f in selected:
+        col = fields.index(f)+1
+        cmds.append("plot \""+dataFile.name+"\" using ($"+str(timeCol)+"/1e9):"+str(col)+
+                    " with lines title \""+f.replace("_", " ")+"\"")
+    cmds.append("unset multiplot")
+    script = "\n".join(cmds)+"\n"
+
+    gnuplot = ["gnuplot"] if outFile else ["gnuplot", "-persist"]
+    subprocess.run(gnuplot, input=script, universal_newlines=True, check=True)
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
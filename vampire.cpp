@@ -30,6 +30,7 @@
 #include "Lib/Int.hpp"
 #include "Lib/MapToLIFO.hpp"
 #include "Lib/Random.hpp"
+#include "Lib/ReplayLog.hpp"
 #include "Lib/Set.hpp"
 #include "Lib/Stack.hpp"
 #include "Lib/TimeCounter.hpp"
@@ -857,6 +858,28 @@ int main(int argc, char* argv[])
     }
 
     Allocator::setMemoryLimit(env.options->memoryLimit() * 1048576ul);
+    if (env.options->allocatorTelemetry()) {
+      Allocator::enableTelemetry();
+    }
+    if (env.options->statisticsDump()!="off") {
+      System::enableStatisticsDumpSignal();
+    }
+    if (env.options->sampleProfile()!="off") {
+#if VCALL_SITES && !VDEBUG
+      Debug::CallSites::startSampling(env.options->sampleProfile().c_str(), env.options->sampleProfileInterval());
+#else
+      USER_ERROR("sample_profile needs a release build with VCALL_SITES=1");
+#endif
+    }
+    if (env.options->recordReplay()!="off") {
+      ReplayLog::startRecording(env.options->recordReplay().c_str(), argc, argv);
+    }
+    if (env.options->replay()!="off") {
+      if (env.options->mode()!=Options::Mode::VAMPIRE) {
+        USER_ERROR("replay is only supported in the vampire mode, use --decode to replay a strategy of a portfolio");
+      }
+      ReplayLog::startReplay(env.options->replay().c_str());
+    }
     Lib::Random::setSeed(env.options->randomSeed());
 
     switch (env.options->mode())
@@ -0,0 +1,620 @@
+
+/*
+ * File vbench.cpp.
+ *
+ * This file is part of the source code of the software program
+ * Vampire. It is protected by applicable
+ * copyright laws.
+ *
+ * This source code is distributed under the licence found here
+ * https://vprover.github.io/license.html
+ * and in the source directory
+ */
+/**
+ * @file vbench.cpp
+ * Provides main function for the vbench executable, which runs
+ * micro-benchmarks of core data structures and algorithms.
+ *
+ * Every benchmark builds its input with a generator seeded by a fixed
+ * value, or, when the input must differ between the repetitions, by
+ * a value derived from the size and the repetition index, so two runs
+ * measure the same work. Every benchmark is run for several
+ * input sizes. The results are printed as JSON, one object per benchmark
+ * and size, in a fixed order. Times are medians over the repetitions.
+ *
+ * Usage: vbench [-l] [-r repetitions] [benchmark_name_prefix ...]
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+#include "Forwards.hpp"
+
+#include "Debug/Tracer.hpp"
+
+#include "Lib/Allocator.hpp"
+#include "Lib/DHMap.hpp"
+#include "Lib/Environment.hpp"
+#include "Lib/Exception.hpp"
+#include "Lib/Int.hpp"
+#include "Lib/List.hpp"
+#include "Lib/Random.hpp"
+#include "Lib/Stack.hpp"
+#include "Lib/System.hpp"
+#include "Lib/TimeCounter.hpp"
+
+#include "Kernel/Clause.hpp"
+#include "Kernel/Inference.hpp"
+#include "Kernel/KBO.hpp"
+#include "Kernel/Matcher.hpp"
+#include "Kernel/MLMatcher.hpp"
+#include "Kernel/Problem.hpp"
+#include "Kernel/RobSubstitution.hpp"
+#include "Kernel/Signature.hpp"
+#include "Kernel/Sorts.hpp"
+#include "Kernel/SubstHelper.hpp"
+#include "Kernel/Substitution.hpp"
+#include "Kernel/Term.hpp"
+
+#include "Indexing/TermSubstitutionTree.hpp"
+
+#include "SAT/SATClause.hpp"
+#include "SAT/SATLiteral.hpp"
+#include "SAT/TWLSolver.hpp"
+
+#include "Shell/Options.hpp"
+#include "Shell/Statistics.hpp"
+
+using namespace Lib;
+using namespace Kernel;
+using namespace Indexing;
+using namespace SAT;
+
+namespace {
+
+const int GENERATOR_SEED = 20200612;
+
+/**
+ * Passed to a benchmark, which does its setup, then measures the
+ * benchmarked code between start() and stop().
+ */
+class BenchmarkTimer
+{
+public:
+  explicit BenchmarkTimer(unsigned repetition) : _repetition(repetition), _time(0), _ops(0) {}
+
+  /** Index of the repetition being measured, counted from 0 for every size */
+  unsigned repetition() const { return _repetition; }
+
+  void start() { _start = TimeCounter::now(); }
+  /** Stop measuring, @b ops is the number of operations performed */
+  void stop(unsigned long ops)
+  {
+    _time = TimeCounter::now()-_start;
+    _ops = ops;
+  }
+
+  long long time() const { return _time; }
+  unsigned long ops() const { return _ops; }
+private:
+  unsigned _repetition;
+  long long _start;
+  long long _time;
+  unsigned long _ops;
+};
+
+/** Keeps the benchmarked results alive, so that the compiler cannot drop the computation */
+volatile unsigned long sink;
+
+////////////////////////////////////////////////////////////////////////////////
+// Generators
+
+/** Symbols of the synthetic signature */
+struct SyntheticSignature
+{
+  Stack<unsigned> constants;
+  Stack<unsigned> functions;
+  unsigned predicate;
+
+  SyntheticSignature()
+  {
+    CALL("SyntheticSignature::SyntheticSignature");
+
+    static const unsigned arities[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3};
+    static const unsigned argSorts[] = {Sorts::SRT_DEFAULT, Sorts::SRT_DEFAULT, Sorts::SRT_DEFAULT};
+    for (unsigned i=0; i<sizeof(arities)/sizeof(arities[0]); i++) {
+      unsigned arity = arities[i];
+      unsigned fn = env.signature->addFunction("vb"+Int::toString(i), arity);
+      env.signature->getFunction(fn)->setType(OperatorType::getFunctionType(arity, argSorts, Sorts::SRT_DEFAULT));
+      (arity ? functions : constants).push(fn);
+    }
+    predicate = env.signature->addPredicate("vbp", 2);
+    env.signature->getPredicate(predicate)->setType(OperatorType::getPredicateType(2, argSorts));
+  }
+
+  /**
+   * Random term of depth at most @b depth. The leaves are variables
+   * among the first @b varCnt ones (if any), or constants.
+   */
+  TermList term(unsigned depth, unsigned varCnt, bool leafAllowed=true)
+  {
+    if (depth==0 || (leafAllowed && Random::getInteger(3)==0)) {
+      if (varCnt && Random::getInteger(3)==0) {
+        return TermList(Random::getInteger(varCnt), false);
+      }
+      return TermList(Term::createConstant(constants[Random::getInteger(constants.size())]));
+    }
+    unsigned fn = functions[Random::getInteger(functions.size())];
+    unsigned arity = env.signature->functionArity(fn);
+    TermList args[3];
+    for (unsigned i=0; i<arity; i++) {
+      args[i] = term(depth-1, varCnt);
+    }
+    return TermList(Term::create(fn, arity, args));
+  }
+
+  /** Random term of depth at most @b depth with a function symbol at the top */
+  TermList complexTerm(unsigned depth, unsigned varCnt)
+  {
+    return term(depth, varCnt, false);
+  }
+
+  Literal* literal(unsigned depth, unsigned varCnt)
+  {
+    TermList args[2] = { term(depth, varCnt), term(depth, varCnt) };
+    return Literal::create(predicate, 2, Random::getBit(), false, args);
+  }
+};
+
+SyntheticSignature& signature()
+{
+  static SyntheticSignature sig;
+  return sig;
+}
+
+Clause* unitClause(Literal* lit)
+{
+  Clause* cl = new(1) Clause(1, NonspecificInference0(UnitInputType::AXIOM, InferenceRule::INPUT));
+  (*cl)[0] = lit;
+  return cl;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+
+/** The top symbol and the arguments of a term that is yet to be created */
+struct TermArgs
+{
+  unsigned functor;
+  unsigned arity;
+  TermList args[3];
+};
+
+/**
+ * Generate the top symbols and the arguments of @b size random terms,
+ * so that the benchmarks time only the creation of the terms themselves
+ * and not the random generator. The arguments are shared already.
+ */
+void generateTermArgs(unsigned size, Stack<TermArgs>& res)
+{
+  SyntheticSignature& sig = signature();
+  res.reset();
+  while (res.size()<size) {
+    TermArgs ta;
+    ta.functor = sig.functions[Random::getInteger(sig.functions.size())];
+    ta.arity = env.signature->functionArity(ta.functor);
+    for (unsigned i=0; i<ta.arity; i++) {
+      ta.args[i] = sig.term(5, 0);
+    }
+    res.push(ta);
+  }
+}
+
+void termSharingInsert(unsigned size, BenchmarkTimer& timer)
+{
+  // a seed for every size and repetition, so that the terms are not
+  // shared already by a previous repetition
+  Random::setSeed(GENERATOR_SEED+size+timer.repetition()+1);
+  static Stack<TermArgs> terms;
+  generateTermArgs(size, terms);
+
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    TermArgs& ta = terms[i];
+    sink += TermList(Term::create(ta.functor, ta.arity, ta.args)).content();
+  }
+  timer.stop(size);
+}
+
+void termSharingLookup(unsigned size, BenchmarkTimer& timer)
+{
+  Random::setSeed(GENERATOR_SEED);
+  static Stack<TermArgs> terms;
+  generateTermArgs(size, terms);
+  for (unsigned i=0; i<size; i++) {
+    TermArgs& ta = terms[i];
+    Term::create(ta.functor, ta.arity, ta.args);
+  }
+
+  // creating the same terms again finds each of them in the sharing index
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    TermArgs& ta = terms[i];
+    sink += TermList(Term::create(ta.functor, ta.arity, ta.args)).content();
+  }
+  timer.stop(size);
+}
+
+enum SubstitutionTreeQuery { UNIFICATIONS, GENERALIZATIONS, INSTANCES };
+
+void substitutionTreeQuery(unsigned size, BenchmarkTimer& timer, SubstitutionTreeQuery query)
+{
+  static const unsigned QUERY_CNT = 100;
+
+  SyntheticSignature& sig = signature();
+  Random::setSeed(GENERATOR_SEED);
+
+  // variables at the top would unify with everything, so neither the
+  // indexed terms nor the queries have them
+  TermSubstitutionTree tree;
+  Stack<Clause*> clauses;
+  for (unsigned i=0; i<size; i++) {
+    TermList args[2] = { sig.complexTerm(4, 3), sig.complexTerm(4, 3) };
+    Literal* lit = Literal::create(sig.predicate, 2, true, false, args);
+    Clause* cl = unitClause(lit);
+    cl->incRefCnt();
+    clauses.push(cl);
+    tree.insert(*lit->nthArgument(0), lit, cl);
+  }
+  Stack<TermList> queries;
+  for (unsigned i=0; i<QUERY_CNT; i++) {
+    queries.push(sig.complexTerm(4, 3));
+  }
+
+  unsigned long results = 0;
+  timer.start();
+  Stack<TermList>::BottomFirstIterator qit(queries);
+  while (qit.hasNext()) {
+    TermList t = qit.next();
+    TermQueryResultIterator rit = query==UNIFICATIONS ? tree.getUnifications(t, true)
+      : query==GENERALIZATIONS ? tree.getGeneralizations(t, true) : tree.getInstances(t, true);
+    while (rit.hasNext()) {
+      rit.next();
+      results++;
+    }
+  }
+  timer.stop(QUERY_CNT);
+  sink += results;
+
+  Stack<Clause*>::Iterator cit(clauses);
+  while (cit.hasNext()) {
+    Clause* cl = cit.next();
+    tree.remove(*(*cl)[0]->nthArgument(0), (*cl)[0], cl);
+    cl->decRefCnt();
+  }
+}
+
+void substitutionTreeUnify(unsigned size, BenchmarkTimer& timer)
+{ substitutionTreeQuery(size, timer, UNIFICATIONS); }
+void substitutionTreeGeneralize(unsigned size, BenchmarkTimer& timer)
+{ substitutionTreeQuery(size, timer, GENERALIZATIONS); }
+void substitutionTreeInstances(unsigned size, BenchmarkTimer& timer)
+{ substitutionTreeQuery(size, timer, INSTANCES); }
+
+void kboCompare(unsigned size, BenchmarkTimer& timer)
+{
+  SyntheticSignature& sig = signature();
+  Random::setSeed(GENERATOR_SEED);
+
+  Problem prb;
+  KBO kbo(prb, *env.options);
+  Stack<TermList> terms;
+  for (unsigned i=0; i<2*size; i++) {
+    terms.push(sig.term(5, 4));
+  }
+
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    sink += kbo.compare(terms[2*i], terms[2*i+1]);
+  }
+  timer.stop(size);
+}
+
+void mlMatcherSubsumption(unsigned size, BenchmarkTimer& timer)
+{
+  static const unsigned BASE_LEN = 3;
+  static const unsigned INSTANCE_LEN = 6;
+
+  SyntheticSignature& sig = signature();
+  Random::setSeed(GENERATOR_SEED);
+
+  // the instance clause contains an instance of the base clause, mixed
+  // with unrelated literals
+  Stack<Clause*> bases;
+  Stack<Clause*> instances;
+  // alternatives for the base literals, BASE_LEN lists per base clause
+  Stack<LiteralList*> alts;
+  for (unsigned i=0; i<size; i++) {
+    Clause* base = new(BASE_LEN) Clause(BASE_LEN, NonspecificInference0(UnitInputType::AXIOM, InferenceRule::INPUT));
+    Substitution subst;
+    for (unsigned v=0; v<4; v++) {
+      subst.bind(v, sig.term(2, 0));
+    }
+    Clause* instance = new(INSTANCE_LEN) Clause(INSTANCE_LEN, NonspecificInference0(UnitInputType::AXIOM, InferenceRule::INPUT));
+    for (unsigned j=0; j<INSTANCE_LEN; j++) {
+      (*instance)[j] = sig.literal(3, 0);
+    }
+    for (unsigned j=0; j<BASE_LEN; j++) {
+      (*base)[j] = sig.literal(2, 4);
+      (*instance)[Random::getInteger(INSTANCE_LEN)] = SubstHelper::apply((*base)[j], subst);
+    }
+    base->incRefCnt();
+    instance->incRefCnt();
+
+    for (unsigned j=0; j<BASE_LEN; j++) {
+      LiteralList* baseAlts = LiteralList::empty();
+      for (unsigned k=0; k<INSTANCE_LEN; k++) {
+        if (MatchingUtils::match((*base)[j], (*instance)[k], false)) {
+          LiteralList::push((*instance)[k], baseAlts);
+        }
+      }
+      alts.push(baseAlts);
+    }
+    bases.push(base);
+    instances.push(instance);
+  }
+
+  unsigned long matched = 0;
+  MLMatcher matcher;
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    matcher.init(bases[i], instances[i], alts.begin()+i*BASE_LEN, true);
+    if (matcher.nextMatch()) {
+      matched++;
+    }
+  }
+  timer.stop(size);
+  sink += matched;
+
+  while (alts.isNonEmpty()) {
+    LiteralList::destroy(alts.pop());
+  }
+  for (unsigned i=0; i<size; i++) {
+    bases[i]->decRefCnt();
+    instances[i]->decRefCnt();
+  }
+}
+
+void robSubstitutionUnify(unsigned size, BenchmarkTimer& timer)
+{
+  SyntheticSignature& sig = signature();
+  Random::setSeed(GENERATOR_SEED);
+
+  Stack<TermList> terms;
+  for (unsigned i=0; i<2*size; i++) {
+    terms.push(sig.term(3, 4));
+  }
+
+  unsigned long unified = 0;
+  RobSubstitution subst;
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    subst.reset();
+    if (subst.unify(terms[2*i], 0, terms[2*i+1], 1)) {
+      unified++;
+    }
+  }
+  timer.stop(size);
+  sink += unified;
+}
+
+void dhMapInsertFind(unsigned size, BenchmarkTimer& timer)
+{
+  Random::setSeed(GENERATOR_SEED);
+  Stack<unsigned> keys;
+  for (unsigned i=0; i<size; i++) {
+    keys.push(Random::getInteger());
+  }
+
+  DHMap<unsigned,unsigned> map;
+  unsigned long found = 0;
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    map.insert(keys[i], i);
+  }
+  for (unsigned i=0; i<size; i++) {
+    unsigned val;
+    if (map.find(keys[size-1-i], val)) {
+      found += val;
+    }
+  }
+  timer.stop(2*size);
+  sink += found;
+}
+
+void stackPushPop(unsigned size, BenchmarkTimer& timer)
+{
+  Stack<unsigned> stack;
+  unsigned long sum = 0;
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    stack.push(i);
+  }
+  Stack<unsigned>::Iterator sit(stack);
+  while (sit.hasNext()) {
+    sum += sit.next();
+  }
+  while (stack.isNonEmpty()) {
+    sum += stack.pop();
+  }
+  timer.stop(3*size);
+  sink += sum;
+}
+
+void allocatorAllocFree(unsigned size, BenchmarkTimer& timer)
+{
+  Random::setSeed(GENERATOR_SEED);
+  Stack<size_t> sizes;
+  Stack<unsigned> freeOrder;
+  for (unsigned i=0; i<size; i++) {
+    sizes.push(8*(1+Random::getInteger(32)));
+    freeOrder.push(i);
+  }
+  for (unsigned i=size; i>1; i--) {
+    swap(freeOrder[i-1], freeOrder[Random::getInteger(i)]);
+  }
+  DArray<void*> blocks(size);
+
+  timer.start();
+  for (unsigned i=0; i<size; i++) {
+    blocks[i] = ALLOC_KNOWN(sizes[i], "vbench");
+  }
+  for (unsigned i=0; i<size; i++) {
+    unsigned idx = freeOrder[i];
+    DEALLOC_KNOWN(blocks[idx], sizes[idx], "vbench");
+  }
+  timer.stop(2*size);
+}
+
+/**
+ * Solve a random 3-SAT problem with @b size variables, under the
+ * satisfiability threshold so that the search is dominated by propagation.
+ * The operations are the propagated literals.
+ */
+void twlSolverPropagation(unsigned size, BenchmarkTimer& timer)
+{
+  Random::setSeed(GENERATOR_SEED);
+
+  TWLSolver solver(*env.options);
+  solver.ensureVarCount(size);
+  unsigned clauseCnt = 3*size;
+  for (unsigned i=0; i<clauseCnt; i++) {
+    SATLiteralStack lits;
+    while (lits.size()<3) {
+      SATLiteral lit(1+Random::getInteger(size), Random::getBit());
+      if (!lits.find(lit) && !lits.find(lit.opposite())) {
+        lits.push(lit);
+      }
+    }
+    solver.addClause(SATClause::fromStack(lits));
+  }
+
+  unsigned long propagations = env.statistics->satTWLPropagations;
+  timer.start();
+  sink += solver.solve(UINT_MAX);
+  timer.stop(env.statistics->satTWLPropagations-propagations);
+}
+
+typedef void (*BenchmarkFn)(unsigned size, BenchmarkTimer& timer);
+
+struct Benchmark
+{
+  const char* name;
+  BenchmarkFn fn;
+  unsigned sizes[3];
+};
+
+const Benchmark benchmarks[] = {
+  {"term_sharing_insert", termSharingInsert, {1000, 10000, 100000}},
+  {"term_sharing_lookup", termSharingLookup, {1000, 10000, 100000}},
+  {"substitution_tree_unify", substitutionTreeUnify, {1000, 10000, 100000}},
+  {"substitution_tree_generalize", substitutionTreeGeneralize, {1000, 10000, 100000}},
+  {"substitution_tree_instances", substitutionTreeInstances, {1000, 10000, 100000}},
+  {"kbo_compare", kboCompare, {1000, 10000, 100000}},
+  {"mlmatcher_subsumption", mlMatcherSubsumption, {1000, 10000, 100000}},
+  {"rob_substitution_unify", robSubstitutionUnify, {1000, 10000, 100000}},
+  {"dhmap_insert_find", dhMapInsertFind, {1000, 100000, 1000000}},
+  {"stack_push_pop", stackPushPop, {1000, 100000, 1000000}},
+  {"allocator_alloc_free", allocatorAllocFree, {1000, 100000, 1000000}},
+  {"twl_solver_propagation", twlSolverPropagation, {100, 1000, 10000}},
+};
+
+/** Run @b bench with @b size @b repetitions times and print a JSON object with the results */
+void runBenchmark(const Benchmark& bench, unsigned size, unsigned repetitions, bool first)
+{
+  CALL("runBenchmark");
+
+  Stack<long long> times;
+  unsigned long ops = 0;
+  for (unsigned i=0; i<repetitions; i++) {
+    BenchmarkTimer timer(i);
+    bench.fn(size, timer);
+    times.push(timer.time());
+    ops = timer.ops();
+  }
+  std::sort(times.begin(), times.end());
+  long long median = times[times.size()/2];
+
+  cout << (first ? "" : ",\n") << "    {\"name\": \"" << bench.name << "\", \"size\": " << size
+       << ", \"repetitions\": " << repetitions << ", \"ops\": " << ops
+       << ", \"median_ns\": " << median << ", \"min_ns\": " << times[0]
+       << ", \"median_ns_per_op\": " << fixed << setprecision(1) << (ops ? median/(double)ops : 0.0)
+       << "}" << flush;
+}
+
+bool selected(const Benchmark& bench, Stack<const char*>& prefixes)
+{
+  if (prefixes.isEmpty()) {
+    return true;
+  }
+  Stack<const char*>::Iterator pit(prefixes);
+  while (pit.hasNext()) {
+    const char* prefix = pit.next();
+    if (!strncmp(bench.name, prefix, strlen(prefix))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+  CALL("main");
+
+  System::registerArgv0(argv[0]);
+  System::setSignalHandlers();
+  Allocator::setMemoryLimit(env.options->memoryLimit() * 1048576ul);
+  env.options->setTimeLimitInSeconds(0);
+
+  unsigned repetitions = 5;
+  Stack<const char*> prefixes;
+  for (int i=1; i<argc; i++) {
+    if (!strcmp(argv[i], "-l")) {
+      for (const Benchmark& bench : benchmarks) {
+        cout << bench.name << endl;
+      }
+      return 0;
+    }
+    if (!strcmp(argv[i], "-r") && i+1<argc) {
+      if (!Int::stringToUnsignedInt(argv[++i], repetitions) || !repetitions) {
+        cout << "Invalid number of repetitions: " << argv[i] << endl;
+        return 1;
+      }
+      continue;
+    }
+    prefixes.push(argv[i]);
+  }
+
+  try {
+    cout << "{\n  \"benchmarks\": [\n";
+    bool first = true;
+    for (const Benchmark& bench : benchmarks) {
+      if (!selected(bench, prefixes)) {
+        continue;
+      }
+      for (unsigned size : bench.sizes) {
+        runBenchmark(bench, size, repetitions, first);
+        first = false;
+      }
+    }
+    cout << "\n  ]\n}" << endl;
+  }
+  catch (Exception& exception) {
+    exception.cry(cerr);
+    return 1;
+  }
+  return 0;
+}